@@ -106,7 +106,18 @@ Arg::Arg(int argc, char *argv[])
   d_light(false),
   d_themeswitching(false),
   d_searchpage(false),
-  d_findrecipient(-1)
+  d_findrecipient(-1),
+  d_threads(1),
+  d_mmap(false),
+  d_frameindex(std::string()),
+  d_timings(false),
+  d_keycache(std::string()),
+  d_workdbdir(std::string()),
+  d_sqlprofile(0),
+  d_sqlprofilejson(std::string()),
+  d_transcode(false),
+  d_stripattachmentdata(false),
+  d_maxoutstandingfiles(0)
 {
   // vector to hold arguments
   std::vector<std::string> config;
@@ -1138,6 +1149,149 @@ bool Arg::parseArgs(std::vector<std::string> const &arguments)
       }
       continue;
     }
+    if (option == "--threads")
+    {
+      if (i < arguments.size() - 1)
+      {
+        if (!ston(&d_threads, arguments[++i]))
+        {
+          std::cerr << "[ Error parsing command line option `" << option << "': Bad argument. ]" << std::endl;
+          ok = false;
+        }
+      }
+      else
+      {
+        std::cerr << "[ Error parsing command line option `" << option << "': Missing argument. ]" << std::endl;
+        ok = false;
+      }
+      continue;
+    }
+    if (option == "--mmap")
+    {
+      d_mmap = true;
+      continue;
+    }
+    if (option == "--no-mmap")
+    {
+      d_mmap = false;
+      continue;
+    }
+    if (option == "--frameindex")
+    {
+      if (i < arguments.size() - 1)
+      {
+        d_frameindex = arguments[++i];
+      }
+      else
+      {
+        std::cerr << "[ Error parsing command line option `" << option << "': Missing argument. ]" << std::endl;
+        ok = false;
+      }
+      continue;
+    }
+    if (option == "--timings")
+    {
+      d_timings = true;
+      continue;
+    }
+    if (option == "--no-timings")
+    {
+      d_timings = false;
+      continue;
+    }
+    if (option == "--keycache")
+    {
+      if (i < arguments.size() - 1)
+      {
+        d_keycache = arguments[++i];
+      }
+      else
+      {
+        std::cerr << "[ Error parsing command line option `" << option << "': Missing argument. ]" << std::endl;
+        ok = false;
+      }
+      continue;
+    }
+    if (option == "--workdbdir")
+    {
+      if (i < arguments.size() - 1)
+      {
+        d_workdbdir = arguments[++i];
+      }
+      else
+      {
+        std::cerr << "[ Error parsing command line option `" << option << "': Missing argument. ]" << std::endl;
+        ok = false;
+      }
+      continue;
+    }
+    if (option == "--sqlprofile")
+    {
+      if (i < arguments.size() - 1)
+      {
+        if (!ston(&d_sqlprofile, arguments[++i]))
+        {
+          std::cerr << "[ Error parsing command line option `" << option << "': Bad argument. ]" << std::endl;
+          ok = false;
+        }
+      }
+      else
+      {
+        std::cerr << "[ Error parsing command line option `" << option << "': Missing argument. ]" << std::endl;
+        ok = false;
+      }
+      continue;
+    }
+    if (option == "--sqlprofilejson")
+    {
+      if (i < arguments.size() - 1)
+      {
+        d_sqlprofilejson = arguments[++i];
+      }
+      else
+      {
+        std::cerr << "[ Error parsing command line option `" << option << "': Missing argument. ]" << std::endl;
+        ok = false;
+      }
+      continue;
+    }
+    if (option == "--transcode")
+    {
+      d_transcode = true;
+      continue;
+    }
+    if (option == "--no-transcode")
+    {
+      d_transcode = false;
+      continue;
+    }
+    if (option == "--stripattachmentdata")
+    {
+      d_stripattachmentdata = true;
+      continue;
+    }
+    if (option == "--no-stripattachmentdata")
+    {
+      d_stripattachmentdata = false;
+      continue;
+    }
+    if (option == "--maxoutstandingfiles")
+    {
+      if (i < arguments.size() - 1)
+      {
+        if (!ston(&d_maxoutstandingfiles, arguments[++i]))
+        {
+          std::cerr << "[ Error parsing command line option `" << option << "': Bad argument. ]" << std::endl;
+          ok = false;
+        }
+      }
+      else
+      {
+        std::cerr << "[ Error parsing command line option `" << option << "': Missing argument. ]" << std::endl;
+        ok = false;
+      }
+      continue;
+    }
     if (option[0] != '-')
     {
       if (d_positionals >= 2)
@@ -33,7 +33,7 @@
 class Arg
 {
   bool d_ok;
-  std::array<std::string, 86> const d_alloptions{"-i", "--input", "-p", "--passphrase", "--importthreads", "--importthreadsbyname", "--limittothreads", "--limittothreadsbyname", "-o", "--output", "-op", "--opassphrase", "-s", "--source", "-sp", "--sourcepassphrase", "--croptothreads", "--croptothreadsbyname", "--croptodates", "--mergerecipients", "--mergegroups", "--exportcsv", "--exportxml", "--runsqlquery", "--runprettysqlquery", "--limitcontacts", "--assumebadframesizeonbadmac", "--editattachmentsize", "--dumpdesktopdb", "--dumpmedia", "--dumpavatars", "--hhenkel", "--devcustom", "--importcsv", "--mapcsvfields", "-//", "--importwachat", "--setselfid", "--onlydb", "--overwrite", "--listthreads", "--listrecipients", "--editgroupmembers", "--showprogress", "--removedoubles", "--reordermmssmsids", "--stoponerror", "-v", "--verbose", "--strugee", "--strugee3", "--ashmorgan", "--strugee2", "--deleteattachments", "--onlyinthreads", "--onlyolderthan", "--onlynewerthan", "--onlylargerthan", "--onlytype", "--appendbody", "--prependbody", "--replaceattachments", "-h", "--help", "--scanmissingattachments", "--showdbinfo", "--scramble", "--importfromdesktop", "--limittodates", "--autolimitdates", "--ignorewal", "--includemms", "--checkdbintegrity", "--interactive", "--exporthtml", "--includecalllog", "--exporttxt", "--append", "--split", "--desktopdbversion", "--migratedb", "--addincompletedataforhtmlexport", "--light", "--themeswitching", "--searchpage", "--findrecipient"};
+  std::array<std::string, 97> const d_alloptions{"-i", "--input", "-p", "--passphrase", "--importthreads", "--importthreadsbyname", "--limittothreads", "--limittothreadsbyname", "-o", "--output", "-op", "--opassphrase", "-s", "--source", "-sp", "--sourcepassphrase", "--croptothreads", "--croptothreadsbyname", "--croptodates", "--mergerecipients", "--mergegroups", "--exportcsv", "--exportxml", "--runsqlquery", "--runprettysqlquery", "--limitcontacts", "--assumebadframesizeonbadmac", "--editattachmentsize", "--dumpdesktopdb", "--dumpmedia", "--dumpavatars", "--hhenkel", "--devcustom", "--importcsv", "--mapcsvfields", "-//", "--importwachat", "--setselfid", "--onlydb", "--overwrite", "--listthreads", "--listrecipients", "--editgroupmembers", "--showprogress", "--removedoubles", "--reordermmssmsids", "--stoponerror", "-v", "--verbose", "--strugee", "--strugee3", "--ashmorgan", "--strugee2", "--deleteattachments", "--onlyinthreads", "--onlyolderthan", "--onlynewerthan", "--onlylargerthan", "--onlytype", "--appendbody", "--prependbody", "--replaceattachments", "-h", "--help", "--scanmissingattachments", "--showdbinfo", "--scramble", "--importfromdesktop", "--limittodates", "--autolimitdates", "--ignorewal", "--includemms", "--checkdbintegrity", "--interactive", "--exporthtml", "--includecalllog", "--exporttxt", "--append", "--split", "--desktopdbversion", "--migratedb", "--addincompletedataforhtmlexport", "--light", "--themeswitching", "--searchpage", "--findrecipient", "--threads", "--mmap", "--frameindex", "--timings", "--keycache", "--workdbdir", "--sqlprofile", "--sqlprofilejson", "--transcode", "--stripattachmentdata", "--maxoutstandingfiles"};
   size_t d_positionals;
   size_t d_maxpositional;
   std::string d_progname;
@@ -119,6 +119,17 @@ class Arg
   bool d_themeswitching;
   bool d_searchpage;
   long long int d_findrecipient;
+  long long int d_threads;
+  bool d_mmap;
+  std::string d_frameindex;
+  bool d_timings;
+  std::string d_keycache;
+  std::string d_workdbdir;
+  long long int d_sqlprofile;
+  std::string d_sqlprofilejson;
+  bool d_transcode;
+  bool d_stripattachmentdata;
+  long long int d_maxoutstandingfiles;
  public:
   Arg(int argc, char *argv[]);
   inline Arg(Arg const &other) = delete;
@@ -210,6 +221,17 @@ class Arg
   inline bool themeswitching() const;
   inline bool searchpage() const;
   inline long long int findrecipient() const;
+  inline long long int threads() const;
+  inline bool mmap() const;
+  inline std::string const &frameindex() const;
+  inline bool timings() const;
+  inline std::string const &keycache() const;
+  inline std::string const &workdbdir() const;
+  inline long long int sqlprofile() const;
+  inline std::string const &sqlprofilejson() const;
+  inline bool transcode() const;
+  inline bool stripattachmentdata() const;
+  inline long long int maxoutstandingfiles() const;
  private:
   template <typename T>
   bool ston(T *t, std::string const &str) const;
@@ -651,6 +673,61 @@ inline long long int Arg::findrecipient() const
   return d_findrecipient;
 }
 
+inline long long int Arg::threads() const
+{
+  return d_threads;
+}
+
+inline bool Arg::mmap() const
+{
+  return d_mmap;
+}
+
+inline std::string const &Arg::frameindex() const
+{
+  return d_frameindex;
+}
+
+inline bool Arg::timings() const
+{
+  return d_timings;
+}
+
+inline std::string const &Arg::keycache() const
+{
+  return d_keycache;
+}
+
+inline std::string const &Arg::workdbdir() const
+{
+  return d_workdbdir;
+}
+
+inline long long int Arg::sqlprofile() const
+{
+  return d_sqlprofile;
+}
+
+inline std::string const &Arg::sqlprofilejson() const
+{
+  return d_sqlprofilejson;
+}
+
+inline bool Arg::transcode() const
+{
+  return d_transcode;
+}
+
+inline bool Arg::stripattachmentdata() const
+{
+  return d_stripattachmentdata;
+}
+
+inline long long int Arg::maxoutstandingfiles() const
+{
+  return d_maxoutstandingfiles;
+}
+
 inline bool Arg::ok() const
 {
   return d_ok;
@@ -42,6 +42,41 @@ changes, you must provide one of the output options.
                                presented to enter the passphrase at runtime (also see `--interactive').
 --no-showprogress              Do not output the progress percentage. Especially useful when redirecting
                                output to file.
+--threads <N>                  Use <N> threads for decrypting the input backup file (default: 1). The
+                               result is identical to the single-threaded read. Also used for
+                               encrypting the output backup file (the output is identical to the
+                               single-threaded write) and for decrypting the database with
+                               `--dumpdesktopdb'. With `--exportcsv', multiple tables are exported in
+                               parallel (unless `--workdbdir' is used).
+--mmap                         Map the input backup file into memory and decrypt straight from the
+                               mapping, instead of reading it through a file stream.
+--frameindex <FILE>            Use <FILE> as index of the frames in the input backup file. If <FILE> does
+                               not exist (or does not match the backup), it is written after reading the
+                               backup. Later runs use it to seek directly to the frames they need.
+--timings                      Print how long loading the backup took, split into reading frames,
+                               executing statements and creating indexes, and the peak memory use.
+--keycache <FILE>              Store the keys derived from backup passphrases in <FILE>, so later runs
+                               on the same backups skip the (slow) key derivation. <FILE> is only
+                               used when it is not accessible by other users.
+--workdbdir <DIR>              Load the backup's database into a temporary file in <DIR> instead of
+                               into memory. Needed for backups with databases larger than the available
+                               RAM. The file is removed when the program ends normally. Note the file
+                               holds the decrypted (unencrypted) database: only use a directory on a
+                               trusted disk. The file is created readable by the owner only.
+--sqlprofile <N>               Time every SQL query, and print the <N> queries that took the most time
+                               in total (with their call count, rows returned and steps taken) at exit.
+                               Queries differing only in their literal values are counted together.
+--sqlprofilejson <FILE>        Like --sqlprofile, but write the statistics of all queries to <FILE> as
+                               JSON.
+--transcode                    Copy the input backup file frame by frame to the output file (`-o'),
+                               re-encrypting it with the output passphrase (`-op'), without loading its
+                               database. Memory use does not grow with the size of the backup, but no
+                               other operations can be applied. Without an output file, the input is
+                               only read completely, verifying all frames and attachments.
+--stripattachmentdata          With `--transcode', leave out all attachment, avatar and sticker data.
+--maxoutstandingfiles <N>      When the output is a directory, decrypt and write up to <N> attachment,
+                               avatar and sticker files at the same time (default: the number of
+                               `--threads').
 --listthreads                  List the threads in the database with their `_id' numbers. These id's are
                                required input for various other options.
 -h, --help                     Show this help message
@@ -22,13 +22,19 @@
 
 #include "../cryptbase/cryptbase.h"
 
+#include <functional>
+
 class FrameWithAttachment;
 
 class BaseDecryptor : public CryptBase
 {
  public:
+  static uint32_t constexpr s_attachmentblocksize = 1024 * 1024;
+
   inline BaseDecryptor() = default;
   static int getAttachment(FrameWithAttachment *frame);
+  static int getAttachmentBlocks(FrameWithAttachment *frame, bool checkmac,
+                                 std::function<bool(unsigned char const *, uint32_t)> const &blockhandler);
 };
 
 #endif
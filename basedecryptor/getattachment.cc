@@ -23,15 +23,21 @@ int BaseDecryptor::getAttachment(FrameWithAttachment *frame) // static
 {
   //std::cout << " *** REALLY GETTING ATTACHMENT ***" << std::endl;
 
-  std::ifstream file(frame->filename(), std::ios_base::binary | std::ios_base::in);
-  if (!file.is_open())
+  // if the backup file is mapped into memory, the data is read directly from there
+  MappedFile const *mappedfile = frame->mappedFile();
+  std::ifstream file;
+  if (!mappedfile)
   {
-    std::cout << "Failed to open backup file '" << frame->filename() << "' for reading attachment" << std::endl;
-    return 1;
-  }
+    file.open(frame->filename(), std::ios_base::binary | std::ios_base::in);
+    if (!file.is_open())
+    {
+      std::cout << "Failed to open backup file '" << frame->filename() << "' for reading attachment" << std::endl;
+      return 1;
+    }
 
-  //std::cout << "Getting attachment: " << frame->filepos() << " + " << frame->length() << std::endl;
-  file.seekg(frame->filepos(), std::ios_base::beg);
+    //std::cout << "Getting attachment: " << frame->filepos() << " + " << frame->length() << std::endl;
+    file.seekg(frame->filepos(), std::ios_base::beg);
+  }
 
   // RAW UNENCRYPTED FILE ATTACHMENT
   if (!frame->cipherkey() ||
@@ -49,45 +55,22 @@ int BaseDecryptor::getAttachment(FrameWithAttachment *frame) // static
     return 0;
   }
 
-  // to decrypt the data
-  // create context
-  std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);
-
-  // disable padding
-  EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
+  // crypto contexts are kept (per thread) between calls, and only rebuilt
+  // when an attachment from a different backup (other keys) is requested
+  thread_local CryptSession cryptsession;
+  if (!cryptsession.keyedWith(frame->mackey(), frame->mackey_size(), frame->cipherkey(), frame->cipherkey_size()) &&
+      !cryptsession.init(frame->mackey(), frame->mackey_size(), "SHA256", frame->cipherkey(), frame->cipherkey_size(), EVP_aes_256_ctr(), false))
+    return 1;
 
-  // init
-  if (EVP_DecryptInit_ex(ctx.get(), EVP_aes_256_ctr(), nullptr, frame->cipherkey(), frame->iv()) != 1)
+  if (!cryptsession.cipherInit(frame->iv()))
   {
     std::cout << "CTX INIT FAILED" << std::endl;
     return 1;
   }
 
   // to calculate the MAC
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-  std::unique_ptr<EVP_MAC, decltype(&::EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, "hmac", nullptr), &::EVP_MAC_free);
-  std::unique_ptr<EVP_MAC_CTX, decltype(&::EVP_MAC_CTX_free)> hctx(EVP_MAC_CTX_new(mac.get()), &::EVP_MAC_CTX_free);
-  char digest[] = "SHA256";
-  OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string("digest", digest, 0), OSSL_PARAM_construct_end()};
-#else
-  std::unique_ptr<HMAC_CTX, decltype(&::HMAC_CTX_free)> hctx(HMAC_CTX_new(), &::HMAC_CTX_free);
-#endif
-
-
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-  if (EVP_MAC_init(hctx.get(), frame->mackey(), frame->mackey_size(), params) != 1)
-#else
-  if (HMAC_Init_ex(hctx.get(), frame->mackey(), frame->mackey_size(), EVP_sha256(), nullptr) != 1)
-#endif
-  {
-    std::cout << "Failed to initialize HMAC context" << std::endl;
-    return 1;
-  }
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-  if (EVP_MAC_update(hctx.get(), frame->iv(), frame->iv_size()) != 1)
-#else
-  if (HMAC_Update(hctx.get(), frame->iv(), frame->iv_size()) != 1)
-#endif
+  if (!cryptsession.macInit() ||
+      !cryptsession.macUpdate(frame->iv(), frame->iv_size()))
   {
     std::cout << "Failed to update HMAC" << std::endl;
     return 1;
@@ -98,30 +81,42 @@ int BaseDecryptor::getAttachment(FrameWithAttachment *frame) // static
   unsigned char encrypteddatabuffer[BUFFERSIZE];
   uint32_t processed = 0;
   uint32_t size = frame->length();
+  unsigned char const *mappeddata = nullptr;
+  if (mappedfile)
+  {
+    if (frame->filepos() + size + MACSIZE > mappedfile->size())
+    {
+      std::cout << " STOPPING BEFORE END OF ATTACHMENT!!! (EOF) " << std::endl;
+      return 1;
+    }
+    mappeddata = mappedfile->data() + frame->filepos();
+  }
   std::unique_ptr<unsigned char[]> decryptedattachmentdata(new unsigned char[size]); // to hold the data
   while (processed < size)
   {
-    if (!file.read(reinterpret_cast<char *>(encrypteddatabuffer), std::min(size - processed, BUFFERSIZE)))
+    uint32_t read = std::min(size - processed, BUFFERSIZE);
+    unsigned char const *encrypteddata = encrypteddatabuffer;
+    if (mappeddata)
+      encrypteddata = mappeddata + processed;
+    else
     {
-      std::cout << " STOPPING BEFORE END OF ATTACHMENT!!!" << (file.eof() ? " (EOF) " : "") << std::endl;
-      return 1;
+      if (!file.read(reinterpret_cast<char *>(encrypteddatabuffer), read))
+      {
+        std::cout << " STOPPING BEFORE END OF ATTACHMENT!!!" << (file.eof() ? " (EOF) " : "") << std::endl;
+        return 1;
+      }
+      read = file.gcount();
     }
-    uint32_t read = file.gcount();
 
     // update MAC with read data
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-    if (EVP_MAC_update(hctx.get(), encrypteddatabuffer, read) != 1)
-#else
-    if (HMAC_Update(hctx.get(), encrypteddatabuffer, read) != 1)
-#endif
+    if (!cryptsession.macUpdate(encrypteddata, read))
     {
       std::cout << "Failed to update HMAC" << std::endl;
       return 1;
     }
 
     // decrypt the read data;
-    int spaceleft = size - processed;
-    if (EVP_DecryptUpdate(ctx.get(), decryptedattachmentdata.get() + processed, &spaceleft, encrypteddatabuffer, read) != 1)
+    if (!cryptsession.cipherUpdate(decryptedattachmentdata.get() + processed, encrypteddata, read))
     {
       std::cout << "Failed to decrypt data" << std::endl;
       return 1;
@@ -132,22 +127,17 @@ int BaseDecryptor::getAttachment(FrameWithAttachment *frame) // static
   }
   DEBUGOUT("Read ", processed, " bytes");
 
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-  unsigned long int digest_size = SHA256_DIGEST_LENGTH;
-  unsigned char hash[SHA256_DIGEST_LENGTH];
-  if (EVP_MAC_final(hctx.get(), hash, nullptr, digest_size) != 1)
-#else
-  unsigned int digest_size = SHA256_DIGEST_LENGTH;
   unsigned char hash[SHA256_DIGEST_LENGTH];
-  if (HMAC_Final(hctx.get(), hash, &digest_size) != 1)
-#endif
+  if (!cryptsession.macFinal(hash))
   {
     std::cout << "Failed to finalize MAC" << std::endl;
     return 1;
   }
 
   unsigned char theirMac[MACSIZE];
-  if (!file.read(reinterpret_cast<char *>(theirMac), MACSIZE))
+  if (mappeddata)
+    std::memcpy(theirMac, mappeddata + size, MACSIZE);
+  else if (!file.read(reinterpret_cast<char *>(theirMac), MACSIZE))
   {
     std::cout << " STOPPING BEFORE END OF ATTACHMENT!!! 2 " << std::endl;
     return 1;
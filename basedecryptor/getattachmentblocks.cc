@@ -0,0 +1,168 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "basedecryptor.ih"
+
+// reads the attachment data in blocks of (at most) s_attachmentblocksize bytes, never holding
+// all of it in memory. The two parameters are independent:
+//  - checkmac: the MAC over the data is verified (after the last block was handled),
+//  - blockhandler: if set, every block is decrypted and passed to it (in order). If not set,
+//    the data is not decrypted at all (eg to only verify an attachment).
+// Returns 0 on success, -1 on a bad MAC and 1 on any other error.
+int BaseDecryptor::getAttachmentBlocks(FrameWithAttachment *frame, bool checkmac,
+                                       std::function<bool(unsigned char const *, uint32_t)> const &blockhandler) // static
+{
+  // if the backup file is mapped into memory, the data is read directly from there
+  MappedFile const *mappedfile = frame->mappedFile();
+  std::ifstream file;
+  if (!mappedfile)
+  {
+    file.open(frame->filename(), std::ios_base::binary | std::ios_base::in);
+    if (!file.is_open())
+    {
+      std::cout << "Failed to open backup file '" << frame->filename() << "' for reading attachment" << std::endl;
+      return 1;
+    }
+    file.seekg(frame->filepos(), std::ios_base::beg);
+  }
+
+  // every thread reads and decrypts into its own reusable buffers
+  thread_local std::unique_ptr<unsigned char[]> readbuffer;
+  thread_local std::unique_ptr<unsigned char[]> decryptbuffer;
+  if (!readbuffer)
+    readbuffer.reset(new unsigned char[s_attachmentblocksize]);
+
+  uint32_t size = frame->length();
+  uint32_t processed = 0;
+
+  // RAW UNENCRYPTED FILE ATTACHMENT
+  if (!frame->cipherkey() ||
+      !frame->mackey() ||
+      !frame->iv())
+  {
+    while (blockhandler && processed < size)
+    {
+      uint32_t read = std::min(size - processed, s_attachmentblocksize);
+      if (!file.read(reinterpret_cast<char *>(readbuffer.get()), read))
+      {
+        std::cout << "Failed to read raw attachment \"" << frame->filename() << "\"" << std::endl;
+        return 1;
+      }
+      if (!blockhandler(readbuffer.get(), read))
+        return 1;
+      processed += read;
+    }
+    return 0;
+  }
+
+  thread_local CryptSession cryptsession;
+  if (!cryptsession.keyedWith(frame->mackey(), frame->mackey_size(), frame->cipherkey(), frame->cipherkey_size()) &&
+      !cryptsession.init(frame->mackey(), frame->mackey_size(), "SHA256", frame->cipherkey(), frame->cipherkey_size(), EVP_aes_256_ctr(), false))
+    return 1;
+
+  if (blockhandler)
+  {
+    if (!decryptbuffer)
+      decryptbuffer.reset(new unsigned char[s_attachmentblocksize]);
+    if (!cryptsession.cipherInit(frame->iv()))
+    {
+      std::cout << "CTX INIT FAILED" << std::endl;
+      return 1;
+    }
+  }
+
+  if (checkmac &&
+      (!cryptsession.macInit() ||
+       !cryptsession.macUpdate(frame->iv(), frame->iv_size())))
+  {
+    std::cout << "Failed to update HMAC" << std::endl;
+    return 1;
+  }
+
+  unsigned char const *mappeddata = nullptr;
+  if (mappedfile)
+  {
+    if (frame->filepos() + size + MACSIZE > mappedfile->size())
+    {
+      std::cout << " STOPPING BEFORE END OF ATTACHMENT!!! (EOF) " << std::endl;
+      return 1;
+    }
+    mappeddata = mappedfile->data() + frame->filepos();
+  }
+
+  while (processed < size)
+  {
+    uint32_t read = std::min(size - processed, s_attachmentblocksize);
+    unsigned char const *encrypteddata = readbuffer.get();
+    if (mappeddata)
+      encrypteddata = mappeddata + processed;
+    else if (!file.read(reinterpret_cast<char *>(readbuffer.get()), read))
+    {
+      std::cout << " STOPPING BEFORE END OF ATTACHMENT!!!" << (file.eof() ? " (EOF) " : "") << std::endl;
+      return 1;
+    }
+
+    if (checkmac && !cryptsession.macUpdate(encrypteddata, read))
+    {
+      std::cout << "Failed to update HMAC" << std::endl;
+      return 1;
+    }
+
+    if (blockhandler)
+    {
+      if (!cryptsession.cipherUpdate(decryptbuffer.get(), encrypteddata, read))
+      {
+        std::cout << "Failed to decrypt data" << std::endl;
+        return 1;
+      }
+      if (!blockhandler(decryptbuffer.get(), read))
+        return 1;
+    }
+
+    processed += read;
+  }
+
+  if (!checkmac)
+    return 0;
+
+  unsigned char hash[SHA256_DIGEST_LENGTH];
+  if (!cryptsession.macFinal(hash))
+  {
+    std::cout << "Failed to finalize MAC" << std::endl;
+    return 1;
+  }
+
+  unsigned char theirMac[MACSIZE];
+  if (mappeddata)
+    std::memcpy(theirMac, mappeddata + size, MACSIZE);
+  else if (!file.read(reinterpret_cast<char *>(theirMac), MACSIZE))
+  {
+    std::cout << " STOPPING BEFORE END OF ATTACHMENT!!! 2 " << std::endl;
+    return 1;
+  }
+
+  if (std::memcmp(theirMac, hash, MACSIZE) != 0)
+  {
+    std::cout << "" << std::endl;
+    std::cout << "WARNING: Bad MAC in attachmentdata: theirMac: " << bepaald::bytesToHexString(theirMac, MACSIZE) << std::endl;
+    std::cout << "                                      ourMac: " << bepaald::bytesToHexString(hash, SHA256_DIGEST_LENGTH) << std::endl;
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,124 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Micro benchmark for CryptSession: MAC and decrypt many small frames, once with freshly
+// created and keyed OpenSSL contexts for every frame (as FileDecryptor used to do), and once
+// with a single pre-keyed CryptSession. Not built by default, configure with
+// -DBUILD_BENCHMARKS=ON and run `cryptsession-bench [frames] [framesize]'.
+
+#include "../cryptsession/cryptsession.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <openssl/sha.h>
+
+namespace
+{
+  unsigned int const MACSIZE = 10;
+
+  bool frameFresh(unsigned char const *mackey, unsigned char const *cipherkey, unsigned char const *iv,
+                  unsigned char const *in, int length, unsigned char *out, unsigned char *hash)
+  {
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    std::unique_ptr<EVP_MAC, decltype(&::EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, "hmac", nullptr), &::EVP_MAC_free);
+    std::unique_ptr<EVP_MAC_CTX, decltype(&::EVP_MAC_CTX_free)> hctx(EVP_MAC_CTX_new(mac.get()), &::EVP_MAC_CTX_free);
+    char digest[] = "SHA256";
+    OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string("digest", digest, 0), OSSL_PARAM_construct_end()};
+    if (EVP_MAC_init(hctx.get(), mackey, 32, params) != 1 ||
+        EVP_MAC_update(hctx.get(), in, length) != 1 ||
+        EVP_MAC_final(hctx.get(), hash, nullptr, SHA256_DIGEST_LENGTH) != 1)
+      return false;
+#else
+    std::unique_ptr<HMAC_CTX, decltype(&::HMAC_CTX_free)> hctx(HMAC_CTX_new(), &::HMAC_CTX_free);
+    unsigned int digest_size = SHA256_DIGEST_LENGTH;
+    if (HMAC_Init_ex(hctx.get(), mackey, 32, EVP_sha256(), nullptr) != 1 ||
+        HMAC_Update(hctx.get(), in, length) != 1 ||
+        HMAC_Final(hctx.get(), hash, &digest_size) != 1)
+      return false;
+#endif
+    std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);
+    int outlength = length;
+    return EVP_DecryptInit_ex(ctx.get(), EVP_aes_256_ctr(), nullptr, cipherkey, iv) == 1 &&
+      EVP_DecryptUpdate(ctx.get(), out, &outlength, in, length) == 1;
+  }
+
+  bool frameSession(CryptSession *cs, unsigned char const *iv, unsigned char const *in, int length,
+                    unsigned char *out, unsigned char *hash)
+  {
+    return cs->macInit() && cs->macUpdate(in, length) && cs->macFinal(hash) &&
+      cs->cipherInit(iv) && cs->cipherUpdate(out, in, length);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  long frames = argc > 1 ? std::atol(argv[1]) : 200000;
+  int framesize = argc > 2 ? std::atoi(argv[2]) : 100;
+  if (frames <= 0 || framesize <= 0)
+  {
+    std::cout << "Usage: " << argv[0] << " [frames] [framesize]" << std::endl;
+    return 1;
+  }
+
+  unsigned char mackey[32], cipherkey[32], iv[16];
+  for (unsigned int i = 0; i < 32; ++i)
+  {
+    mackey[i] = i;
+    cipherkey[i] = 255 - i;
+  }
+  std::vector<unsigned char> in(framesize, 'x');
+  std::vector<unsigned char> out(framesize);
+  unsigned char hash[SHA256_DIGEST_LENGTH];
+  unsigned char check[2][MACSIZE];
+
+  CryptSession cs;
+  if (!cs.init(mackey, 32, "SHA256", cipherkey, 32, EVP_aes_256_ctr(), false))
+    return 1;
+
+  for (int variant = 0; variant < 2; ++variant)
+  {
+    auto t1 = std::chrono::steady_clock::now();
+    for (long f = 0; f < frames; ++f)
+    {
+      std::memcpy(iv, &f, sizeof(f));
+      bool ok = variant == 0 ?
+        frameFresh(mackey, cipherkey, iv, in.data(), framesize, out.data(), hash) :
+        frameSession(&cs, iv, in.data(), framesize, out.data(), hash);
+      if (!ok)
+      {
+        std::cout << "Crypto operation failed" << std::endl;
+        return 1;
+      }
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t1).count() / frames;
+    std::memcpy(check[variant], hash, MACSIZE);
+    std::cout << (variant == 0 ? "fresh contexts per frame : " : "CryptSession             : ")
+              << ns << " ns/frame (" << frames << " frames of " << framesize << " bytes)" << std::endl;
+  }
+
+  if (std::memcmp(check[0], check[1], MACSIZE) != 0)
+  {
+    std::cout << "Results differ!" << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -37,6 +37,7 @@
 #include <windows.h>
 #else // !windows
 #include <sys/ioctl.h>
+#include <sys/resource.h>
 #if __has_include("unistd.h")
 #define HAS_UNISTD_H_
 #include <unistd.h>
@@ -97,6 +98,7 @@ namespace bepaald
   inline std::string toDateString(std::time_t epoch, std::string const &format);
   inline std::string toLower(std::string s);
   inline std::string toUpper(std::string s);
+  inline long long int peakMemoryUsage();
   inline void replaceAll(std::string *in, char from, std::string const &to);
   inline void replaceAll(std::string *in, std::string const &from, std::string const &to);
 
@@ -210,10 +212,7 @@ inline std::string bepaald::bytesToHexString(unsigned char const *data, unsigned
 
 inline std::string bepaald::bytesToString(unsigned char const *data, unsigned int length)
 {
-  std::ostringstream oss;
-  for (uint i = 0; i < length; ++i)
-    oss << static_cast<char>(data[i]);
-  return oss.str();
+  return std::string(reinterpret_cast<char const *>(data), length);
 }
 
 inline std::string bepaald::bytesToPrintableString(unsigned char const *data, unsigned int length)
@@ -399,10 +398,27 @@ inline std::string bepaald::toLower(std::string s)
 
 inline std::string bepaald::toUpper(std::string s)
 {
-  std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c){ return std::tolower(c); });
+  std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c){ return std::toupper(c); });
   return s;
 }
 
+// peak resident set size of this process in bytes, -1 if unknown
+inline long long int bepaald::peakMemoryUsage()
+{
+#if defined(_WIN32) || defined(__MINGW64__)
+  return -1; // would need psapi
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return -1;
+#if defined(__APPLE__) && defined(__MACH__)
+  return usage.ru_maxrss; // bytes on macos
+#else
+  return usage.ru_maxrss * 1024ll; // kilobytes elsewhere
+#endif
+#endif
+}
+
 inline void bepaald::replaceAll(std::string *in, char from, std::string const &to)
 {
   replaceAll(in, std::string(1, from), to);
@@ -22,8 +22,12 @@
 
 #include <cstring>
 #include <cctype>
+#include <map>
+#include <mutex>
+#include <string>
 
 #include "../common_be.h"
+#include "../cryptsession/cryptsession.h"
 
 class CryptBase
 {
@@ -41,15 +45,28 @@ class CryptBase
   unsigned char *d_salt;
   uint64_t d_salt_size;
   uint64_t d_counter;
+  CryptSession d_cryptsession;
+
+  // backup keys already derived in this process, and the optional file
+  // they are stored in between runs (see getBackupKey())
+  inline static std::map<std::string, std::string> s_backupkeycache;
+  inline static std::mutex s_backupkeycachemutex;
+  inline static std::string s_keycachefile;
+  static constexpr size_t s_keycachemaxentries = 32;
  public:
   inline CryptBase();
   CryptBase(CryptBase const &other) = delete;
   CryptBase operator=(CryptBase const &other) = delete;
   inline ~CryptBase();
   inline bool ok() const;
+  inline static void setKeyCacheFile(std::string const &filename);
  protected:
   bool getCipherAndMac(uint hashoutputsize, size_t outputsize);
   bool getBackupKey(std::string const &passphrase);
+  std::string keyCacheId(unsigned char const *pass, size_t passlength) const;
+  static bool readKeyCache(std::string const &id, std::string *backupkey);
+  static bool writeKeyCache(std::string const &id, std::string const &backupkey);
+  static bool keyCachePermissionsOk();
   inline void uintToFourBytes(unsigned char *bytes, uint32_t val) const;
   inline uint32_t fourBytesToUint(unsigned char *b) const;
 };
@@ -84,6 +101,11 @@ inline bool CryptBase::ok() const
   return d_ok;
 }
 
+inline void CryptBase::setKeyCacheFile(std::string const &filename) // static
+{
+  s_keycachefile = filename;
+}
+
 inline void CryptBase::uintToFourBytes(unsigned char *bytes, uint32_t val) const
 {
   val = bepaald::swap_endian(val);
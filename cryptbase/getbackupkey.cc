@@ -51,6 +51,28 @@ bool CryptBase::getBackupKey(std::string const &passphrase)
 
   //std::cout << "Passphrase: " << bepaald::bytesToHexString(pass, passlength) << std::endl;
 
+  // the same backup (or its export with the same passphrase) was opened before?
+  std::string const cacheid(keyCacheId(pass, passlength));
+  if (!cacheid.empty())
+  {
+    std::string cachedkey;
+    {
+      std::lock_guard<std::mutex> lock(s_backupkeycachemutex);
+      auto it = s_backupkeycache.find(cacheid);
+      if (it != s_backupkeycache.end())
+        cachedkey = it->second;
+    }
+    if (!cachedkey.empty() || readKeyCache(cacheid, &cachedkey))
+    {
+      d_backupkey_size = cachedkey.size();
+      d_backupkey = new unsigned char[d_backupkey_size];
+      std::memcpy(d_backupkey, cachedkey.data(), d_backupkey_size);
+      std::lock_guard<std::mutex> lock(s_backupkeycachemutex);
+      s_backupkeycache[cacheid] = std::move(cachedkey);
+      return true;
+    }
+  }
+
   std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_free)> mdctx(EVP_MD_CTX_create(), &::EVP_MD_CTX_free);
 
   if (mdctx.get() == nullptr ||
@@ -86,5 +108,13 @@ bool CryptBase::getBackupKey(std::string const &passphrase)
   d_backupkey = new unsigned char[d_backupkey_size];
   std::memcpy(d_backupkey, digest.get(), d_backupkey_size);
 
+  if (!cacheid.empty())
+  {
+    std::string key(reinterpret_cast<char *>(d_backupkey), d_backupkey_size);
+    writeKeyCache(cacheid, key);
+    std::lock_guard<std::mutex> lock(s_backupkeycachemutex);
+    s_backupkeycache[cacheid] = std::move(key);
+  }
+
   return true;
 }
@@ -0,0 +1,36 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "cryptbase.ih"
+
+// identifies a backup key by salt and passphrase, without storing the
+// passphrase itself: hex(salt) ' ' hex(sha256(salt || passphrase))
+std::string CryptBase::keyCacheId(unsigned char const *pass, size_t passlength) const
+{
+  std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_free)> mdctx(EVP_MD_CTX_create(), &::EVP_MD_CTX_free);
+  unsigned char hash[SHA256_DIGEST_LENGTH];
+  if (mdctx.get() == nullptr ||
+      EVP_DigestInit_ex(mdctx.get(), EVP_sha256(), nullptr) != 1 ||
+      EVP_DigestUpdate(mdctx.get(), d_salt, d_salt_size) != 1 ||
+      EVP_DigestUpdate(mdctx.get(), pass, passlength) != 1 ||
+      EVP_DigestFinal_ex(mdctx.get(), hash, nullptr) != 1)
+    return std::string();
+
+  return bepaald::bytesToHexString(d_salt, d_salt_size, true) + " " + bepaald::bytesToHexString(hash, SHA256_DIGEST_LENGTH, true);
+}
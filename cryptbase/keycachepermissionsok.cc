@@ -0,0 +1,39 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "cryptbase.ih"
+
+// the key cache holds keys that decrypt the backups, it must not be accessible
+// to anyone but its owner
+bool CryptBase::keyCachePermissionsOk() // static
+{
+#if !defined(_WIN32) && !defined(__MINGW64__)
+  std::error_code ec;
+  std::filesystem::perms p = std::filesystem::status(s_keycachefile, ec).permissions();
+  if (ec)
+    return false;
+  if ((p & (std::filesystem::perms::group_all | std::filesystem::perms::others_all)) != std::filesystem::perms::none)
+  {
+    std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Key cache file '" << s_keycachefile
+              << "' is accessible by other users, not using it (chmod 600 to fix)" << std::endl;
+    return false;
+  }
+#endif
+  return true;
+}
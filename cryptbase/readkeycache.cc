@@ -0,0 +1,46 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "cryptbase.ih"
+
+/*
+  key cache file layout, one line per backup key:
+  hex(salt) hex(sha256(salt || passphrase)) hex(backupkey)
+*/
+bool CryptBase::readKeyCache(std::string const &id, std::string *backupkey) // static
+{
+  if (s_keycachefile.empty() || !bepaald::fileOrDirExists(s_keycachefile) || !keyCachePermissionsOk())
+    return false;
+
+  std::ifstream file(s_keycachefile);
+  std::string line;
+  while (std::getline(file, line))
+  {
+    if (line.size() <= id.size() + 1 || line.compare(0, id.size(), id) != 0 || line[id.size()] != ' ')
+      continue;
+
+    std::string hexkey(line.substr(id.size() + 1));
+    std::unique_ptr<unsigned char[]> key(new unsigned char[hexkey.size() / 2]);
+    if (hexkey.size() % 2 || !bepaald::hexStringToBytes(hexkey, key.get(), hexkey.size() / 2))
+      return false;
+    *backupkey = bepaald::bytesToString(key.get(), hexkey.size() / 2);
+    return true;
+  }
+  return false;
+}
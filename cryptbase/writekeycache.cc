@@ -0,0 +1,96 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "cryptbase.ih"
+
+// adds a backup key to the key cache file (see readKeyCache() for layout),
+// keeping at most the last s_keycachemaxentries keys
+bool CryptBase::writeKeyCache(std::string const &id, std::string const &backupkey) // static
+{
+  if (s_keycachefile.empty())
+    return true;
+
+  std::vector<std::string> lines;
+  if (bepaald::fileOrDirExists(s_keycachefile))
+  {
+    if (!keyCachePermissionsOk())
+      return false;
+    std::ifstream file(s_keycachefile);
+    std::string line;
+    while (std::getline(file, line))
+      if (!line.empty() && line.compare(0, id.size(), id) != 0)
+        lines.emplace_back(std::move(line));
+  }
+  lines.emplace_back(id + " " + bepaald::bytesToHexString(reinterpret_cast<unsigned char const *>(backupkey.data()), backupkey.size(), true));
+  if (lines.size() > s_keycachemaxentries)
+    lines.erase(lines.begin(), lines.end() - s_keycachemaxentries);
+
+  std::string contents;
+  for (std::string const &line : lines)
+    contents += line + '\n';
+
+  // the new contents are written to a temporary file in the same directory, which is
+  // created with owner-only permissions (and never through a symlink), and then renamed
+  // over the cache file, so the keys are never readable by others and an interrupted
+  // write leaves the old cache intact
+  auto writefailed = [](std::string const &tmpfile)
+  {
+    if (!tmpfile.empty())
+      std::remove(tmpfile.c_str());
+    std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Failed to write key cache file '" << s_keycachefile << "'" << std::endl;
+    return false;
+  };
+
+#if !defined(_WIN32) && !defined(__MINGW64__)
+  std::string tmpfile = s_keycachefile + ".XXXXXX";
+  int fd = mkstemp(tmpfile.data()); // O_CREAT | O_EXCL, mode 0600
+  if (fd == -1)
+    return writefailed(std::string());
+  char const *data = contents.data();
+  size_t remaining = contents.size();
+  while (remaining)
+  {
+    ssize_t written = write(fd, data, remaining);
+    if (written == -1)
+    {
+      if (errno == EINTR)
+        continue;
+      close(fd);
+      return writefailed(tmpfile);
+    }
+    data += written;
+    remaining -= written;
+  }
+  if (fsync(fd) != 0 || close(fd) != 0)
+    return writefailed(tmpfile);
+#else
+  std::string tmpfile = s_keycachefile + ".tmp";
+  {
+    std::ofstream file(tmpfile, std::ios_base::binary | std::ios_base::trunc);
+    if (!file.is_open() || !file.write(contents.data(), contents.size()))
+      return writefailed(tmpfile);
+  }
+#endif
+
+  std::error_code ec;
+  std::filesystem::rename(tmpfile, s_keycachefile, ec);
+  if (ec)
+    return writefailed(tmpfile);
+  return true;
+}
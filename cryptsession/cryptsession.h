@@ -0,0 +1,176 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef CRYPTSESSION_H_
+#define CRYPTSESSION_H_
+
+#include <memory>
+#include <cstring>
+#include <cstdint>
+
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+// Holds pre-keyed contexts for HMAC and a cipher, so per-frame (or per-page) operations
+// do not need to fetch algorithms, allocate contexts and redo key schedules. The HMAC key
+// is set once in a template context, which is duplicated into the working context, the
+// cipher context is keyed once and only gets its iv reset.
+// A session is not thread safe: give every thread its own, using initFrom().
+class CryptSession
+{
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  EVP_MAC *d_mac;
+  EVP_MAC_CTX *d_hmactemplate;
+  EVP_MAC_CTX *d_hmac;
+#else
+  HMAC_CTX *d_hmactemplate;
+  HMAC_CTX *d_hmac;
+#endif
+  EVP_CIPHER_CTX *d_cipher;
+  unsigned int d_digestsize;
+  std::unique_ptr<unsigned char[]> d_mackey;
+  uint64_t d_mackey_size;
+  std::unique_ptr<unsigned char[]> d_cipherkey;
+  uint64_t d_cipherkey_size;
+  bool d_ok;
+
+ public:
+  inline CryptSession();
+  CryptSession(CryptSession const &other) = delete;
+  CryptSession &operator=(CryptSession const &other) = delete;
+  inline ~CryptSession();
+  bool init(unsigned char const *mackey, uint64_t mackey_size, char const *digest,
+            unsigned char const *cipherkey, uint64_t cipherkey_size, EVP_CIPHER const *cipher, bool encrypt);
+  bool initFrom(CryptSession const &other);
+  inline bool ok() const;
+  inline bool keyedWith(unsigned char const *mackey, uint64_t mackey_size,
+                        unsigned char const *cipherkey, uint64_t cipherkey_size) const;
+  inline unsigned int digestSize() const;
+  inline bool macInit();
+  inline bool macUpdate(unsigned char const *data, uint64_t length);
+  inline bool macFinal(unsigned char *hash);
+  inline bool cipherInit(unsigned char const *iv);
+  inline bool cipherUpdate(unsigned char *out, unsigned char const *in, int length);
+ private:
+  inline void reset();
+};
+
+inline CryptSession::CryptSession()
+  :
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  d_mac(nullptr),
+#endif
+  d_hmactemplate(nullptr),
+  d_hmac(nullptr),
+  d_cipher(nullptr),
+  d_digestsize(0),
+  d_mackey_size(0),
+  d_cipherkey_size(0),
+  d_ok(false)
+{}
+
+inline CryptSession::~CryptSession()
+{
+  reset();
+}
+
+inline void CryptSession::reset()
+{
+  d_ok = false;
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  EVP_MAC_CTX_free(d_hmac);
+  EVP_MAC_CTX_free(d_hmactemplate);
+  EVP_MAC_free(d_mac);
+  d_mac = nullptr;
+#else
+  HMAC_CTX_free(d_hmac);
+  HMAC_CTX_free(d_hmactemplate);
+#endif
+  d_hmac = nullptr;
+  d_hmactemplate = nullptr;
+  EVP_CIPHER_CTX_free(d_cipher);
+  d_cipher = nullptr;
+}
+
+inline bool CryptSession::ok() const
+{
+  return d_ok;
+}
+
+inline bool CryptSession::keyedWith(unsigned char const *mackey, uint64_t mackey_size,
+                                    unsigned char const *cipherkey, uint64_t cipherkey_size) const
+{
+  return d_ok &&
+    mackey_size == d_mackey_size && std::memcmp(mackey, d_mackey.get(), mackey_size) == 0 &&
+    cipherkey_size == d_cipherkey_size && std::memcmp(cipherkey, d_cipherkey.get(), cipherkey_size) == 0;
+}
+
+inline unsigned int CryptSession::digestSize() const
+{
+  return d_digestsize;
+}
+
+// start a new message: the working context is copied from the keyed template
+// once, after that a re-init without key just resets it (keeping the key)
+inline bool CryptSession::macInit()
+{
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  if (!d_hmac) [[unlikely]]
+    return (d_hmac = EVP_MAC_CTX_dup(d_hmactemplate)) != nullptr;
+  return EVP_MAC_init(d_hmac, nullptr, 0, nullptr) == 1;
+#else
+  if (!d_hmac) [[unlikely]]
+    return (d_hmac = HMAC_CTX_new()) != nullptr && HMAC_CTX_copy(d_hmac, d_hmactemplate) == 1;
+  return HMAC_Init_ex(d_hmac, nullptr, 0, nullptr, nullptr) == 1;
+#endif
+}
+
+inline bool CryptSession::macUpdate(unsigned char const *data, uint64_t length)
+{
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  return EVP_MAC_update(d_hmac, data, length) == 1;
+#else
+  return HMAC_Update(d_hmac, data, length) == 1;
+#endif
+}
+
+// hash must be able to hold digestSize() bytes
+inline bool CryptSession::macFinal(unsigned char *hash)
+{
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  return EVP_MAC_final(d_hmac, hash, nullptr, d_digestsize) == 1;
+#else
+  unsigned int digest_size = d_digestsize;
+  return HMAC_Final(d_hmac, hash, &digest_size) == 1;
+#endif
+}
+
+// (re)start the cipher with a new iv, keeping the key schedule
+inline bool CryptSession::cipherInit(unsigned char const *iv)
+{
+  return EVP_CipherInit_ex(d_cipher, nullptr, nullptr, nullptr, iv, -1) == 1;
+}
+
+inline bool CryptSession::cipherUpdate(unsigned char *out, unsigned char const *in, int length)
+{
+  int outlength = length;
+  return EVP_CipherUpdate(d_cipher, out, &outlength, in, length) == 1;
+}
+
+#endif
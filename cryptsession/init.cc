@@ -0,0 +1,71 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "cryptsession.ih"
+
+bool CryptSession::init(unsigned char const *mackey, uint64_t mackey_size, char const *digest,
+                        unsigned char const *cipherkey, uint64_t cipherkey_size, EVP_CIPHER const *cipher, bool encrypt)
+{
+  reset();
+
+  d_mackey.reset(new unsigned char[mackey_size]);
+  std::memcpy(d_mackey.get(), mackey, mackey_size);
+  d_mackey_size = mackey_size;
+  d_cipherkey.reset(new unsigned char[cipherkey_size]);
+  std::memcpy(d_cipherkey.get(), cipherkey, cipherkey_size);
+  d_cipherkey_size = cipherkey_size;
+
+  // set up the keyed HMAC template
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  std::unique_ptr<char[]> digestname(new char[std::strlen(digest) + 1]);
+  std::strcpy(digestname.get(), digest);
+  OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string("digest", digestname.get(), 0), OSSL_PARAM_construct_end()};
+  if (!(d_mac = EVP_MAC_fetch(nullptr, "hmac", nullptr)) ||
+      !(d_hmactemplate = EVP_MAC_CTX_new(d_mac)) ||
+      EVP_MAC_init(d_hmactemplate, mackey, mackey_size, params) != 1)
+  {
+    std::cout << "Failed to initialize HMAC context" << std::endl;
+    return false;
+  }
+  d_digestsize = static_cast<unsigned int>(EVP_MAC_CTX_get_mac_size(d_hmactemplate));
+#else
+  EVP_MD const *md = EVP_get_digestbyname(digest);
+  if (!md ||
+      !(d_hmactemplate = HMAC_CTX_new()) ||
+      HMAC_Init_ex(d_hmactemplate, mackey, mackey_size, md, nullptr) != 1)
+  {
+    std::cout << "Failed to initialize HMAC context" << std::endl;
+    return false;
+  }
+  d_digestsize = EVP_MD_size(md);
+#endif
+
+  // set up the keyed cipher
+  if (!(d_cipher = EVP_CIPHER_CTX_new()) ||
+      EVP_CipherInit_ex(d_cipher, cipher, nullptr, cipherkey, nullptr, encrypt ? 1 : 0) != 1)
+  {
+    std::cout << "CTX INIT FAILED" << std::endl;
+    return false;
+  }
+  // disable padding
+  EVP_CIPHER_CTX_set_padding(d_cipher, 0);
+
+  d_ok = true;
+  return d_ok;
+}
@@ -0,0 +1,61 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "cryptsession.ih"
+
+// set up this session as an independent copy of other (e.g. for use in another thread)
+bool CryptSession::initFrom(CryptSession const &other)
+{
+  reset();
+
+  if (!other.d_ok)
+    return false;
+
+  d_mackey.reset(new unsigned char[other.d_mackey_size]);
+  std::memcpy(d_mackey.get(), other.d_mackey.get(), other.d_mackey_size);
+  d_mackey_size = other.d_mackey_size;
+  d_cipherkey.reset(new unsigned char[other.d_cipherkey_size]);
+  std::memcpy(d_cipherkey.get(), other.d_cipherkey.get(), other.d_cipherkey_size);
+  d_cipherkey_size = other.d_cipherkey_size;
+  d_digestsize = other.d_digestsize;
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  if (!EVP_MAC_up_ref(other.d_mac))
+    return false;
+  d_mac = other.d_mac;
+  if (!(d_hmactemplate = EVP_MAC_CTX_dup(other.d_hmactemplate)))
+#else
+  if (!(d_hmactemplate = HMAC_CTX_new()) ||
+      HMAC_CTX_copy(d_hmactemplate, other.d_hmactemplate) != 1)
+#endif
+  {
+    std::cout << "Failed to copy HMAC context" << std::endl;
+    return false;
+  }
+
+  if (!(d_cipher = EVP_CIPHER_CTX_new()) ||
+      EVP_CIPHER_CTX_copy(d_cipher, other.d_cipher) != 1)
+  {
+    std::cout << "Failed to copy cipher context" << std::endl;
+    return false;
+  }
+
+  d_ok = true;
+  return d_ok;
+}
@@ -19,7 +19,7 @@
 
 #include "filedecryptor.ih"
 
-FileDecryptor::FileDecryptor(std::string const &filename, std::string const &passphrase, bool verbose, bool stoponerror, bool assumebadframesize, std::vector<long long int> editattachments)
+FileDecryptor::FileDecryptor(std::string const &filename, std::string const &passphrase, bool verbose, bool stoponerror, bool assumebadframesize, std::vector<long long int> editattachments, unsigned int numthreads, bool usemmap)
   :
   d_headerframe(nullptr),
   d_file(filename, std::ios_base::binary | std::ios_base::in),
@@ -31,7 +31,16 @@ FileDecryptor::FileDecryptor(std::string const &filename, std::string const &pas
   d_editattachments(editattachments),
   d_verbose(verbose),
   d_stoponerror(stoponerror),
-  d_backupfileversion(0)
+  d_backupfileversion(0),
+  d_mappedpos(0),
+  d_scratchsize(0),
+  d_lastframepos(0),
+  d_lastframecounter(0),
+  d_numthreads(numthreads),
+  d_pipelinefilepos(0),
+  d_pipelinestarted(false),
+  d_producerdone(false),
+  d_stoppipeline(false)
 {
   if (!d_file.is_open())
   {
@@ -100,8 +109,28 @@ FileDecryptor::FileDecryptor(std::string const &filename, std::string const &pas
     return;
   }
 
+  if (!d_cryptsession.init(d_mackey, d_mackey_size, "SHA256", d_cipherkey, d_cipherkey_size, EVP_aes_256_ctr(), false))
+  {
+    std::cout << "Error: Failed to set up crypto contexts" << std::endl;
+    delete headerframe;
+    return;
+  }
+
   d_backupfileversion = reinterpret_cast<HeaderFrame *>(headerframe)->version();
 
+  // old style backups (version 0) are always read through d_file
+  if (usemmap && d_backupfileversion > 0)
+  {
+    d_mappedfile = std::make_shared<MappedFile>(filename);
+    if (d_mappedfile->ok() && d_mappedfile->size() == d_filesize)
+      d_mappedpos = d_file.tellg();
+    else
+    {
+      std::cout << "Failed to map backup file into memory, falling back to reading from file" << std::endl;
+      d_mappedfile.reset();
+    }
+  }
+
   //headerframe->printInfo();
 
   /*
@@ -22,6 +22,11 @@
 
 #include <cstring>
 #include <fstream>
+#include <sstream>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 //#include "../cryptbase/cryptbase.h"
 #include "../common_be.h"
@@ -29,6 +34,7 @@
 #include "../framewithattachment/framewithattachment.h"
 #include "../basedecryptor/basedecryptor.h"
 #include "../invalidframe/invalidframe.h"
+#include "../frameindex/frameindex.h"
 
 class  FileDecryptor : public BaseDecryptor//, public CryptBase
 {
@@ -44,14 +50,66 @@ class  FileDecryptor : public BaseDecryptor//, public CryptBase
   bool d_stoponerror;
   uint32_t d_backupfileversion;
 
+  // when the backup file is mapped into memory (usemmap), frames are MAC'ed
+  // and decrypted straight from the mapping and d_mappedpos replaces the
+  // position of d_file. Frames are decrypted into the reusable d_scratch.
+  std::shared_ptr<MappedFile> d_mappedfile;
+  uint64_t d_mappedpos;
+  std::unique_ptr<unsigned char[]> d_scratch;
+  uint32_t d_scratchsize;
+
+  // position and iv counter of the frame last returned by getFrame()
+  uint64_t d_lastframepos;
+  uint32_t d_lastframecounter;
+
+  // pipelined reading (d_numthreads > 1): a producer thread reads the frames and
+  // decrypts their lengths, d_numthreads workers check the MAC and decrypt/parse
+  // the frames out of order, getFrame() hands them out in file order.
+  struct PipelineFrame
+  {
+    uint64_t d_framenumber;
+    uint64_t d_offset;                        // filepos of this frame
+    uint64_t d_filepos;                       // filepos after this frame (and its attachment data)
+    uint32_t d_counter;
+    uint32_t d_encryptedframelength;
+    unsigned char d_encryptedlength[4];
+    std::unique_ptr<unsigned char[]> d_encryptedframe;  // owns the data, unless read from mapped file
+    unsigned char const *d_encryptedframedata;
+    std::unique_ptr<BackupFrame> d_frame;
+    std::ostringstream d_messages;            // output, printed (in order) by consumer
+    bool d_done;
+    bool d_badmac;
+    bool d_eof;
+  };
+  unsigned int d_numthreads;
+  std::thread d_producer;
+  std::vector<std::thread> d_workers;
+  std::mutex d_pipelinemutex;
+  std::condition_variable d_framedonecv;      // consumer waits for the next frame
+  std::condition_variable d_workcv;           // workers wait for work
+  std::condition_variable d_spacecv;          // producer waits for room in the pipeline
+  std::deque<std::unique_ptr<PipelineFrame>> d_pipeline;
+  std::deque<PipelineFrame *> d_pipelinework;
+  uint64_t d_pipelinefilepos;
+  bool d_pipelinestarted;
+  bool d_producerdone;
+  bool d_stoppipeline;
+  static unsigned int constexpr s_pipelineframesperthread = 256;
+
  public:
-  FileDecryptor(std::string const &filename, std::string const &passphrase, bool verbose, bool stoponerror = false, bool assumebadframesize = false, std::vector<long long int> editattachments = std::vector<long long int>());
+  FileDecryptor(std::string const &filename, std::string const &passphrase, bool verbose, bool stoponerror = false, bool assumebadframesize = false, std::vector<long long int> editattachments = std::vector<long long int>(), unsigned int numthreads = 1, bool usemmap = false);
   FileDecryptor(FileDecryptor const &other) = delete;
   FileDecryptor operator=(FileDecryptor const &other) = delete;
-  //inline ~FileDecryptor();
+  ~FileDecryptor();
   inline bool ok() const;
   std::unique_ptr<BackupFrame> getFrameOld();
   std::unique_ptr<BackupFrame> getFrame();
+  std::unique_ptr<BackupFrame> getFrameAt(uint64_t filepos, uint32_t counter, uint64_t framenumber);
+  void initLazyAttachment(FrameWithAttachment *frame, uint32_t counter, uint32_t attsize, uint64_t filepos) const;
+  inline uint64_t lastFramePos() const;
+  inline uint32_t lastFrameCounter() const;
+  inline bool readFrameIndex(std::string const &filename, FrameIndex *index) const;
+  inline bool writeFrameIndex(std::string const &filename, FrameIndex const &index) const;
   inline uint64_t total() const;
   inline uint64_t curFilePos();
   inline bool badMac() const;
@@ -67,11 +125,22 @@ class  FileDecryptor : public BaseDecryptor//, public CryptBase
  private:
   inline uint32_t getNextFrameBlockSize();
   inline bool getNextFrameBlock(unsigned char *data, size_t length);
+  inline bool getNextFrameBlock(unsigned char const **data, size_t length, std::unique_ptr<unsigned char[]> *buffer);
+  inline uint64_t readPos();
+  inline void skipData(uint64_t length);
+  inline unsigned char *scratchBuffer(uint32_t size);
   BackupFrame *initBackupFrame(unsigned char *data, size_t length, uint64_t count = 0) const;
   //virtual int getAttachment(FrameWithAttachment *frame) override;
 
   std::unique_ptr<BackupFrame> bruteForceFrom(uint64_t filepos, uint32_t previousframelength);
   std::unique_ptr<BackupFrame> getFrameBrute(uint64_t offset, uint32_t previousframelength);
+
+  std::unique_ptr<BackupFrame> getFramePipelined();
+  void startPipeline();
+  void stopPipeline();
+  void pipelineProducer();
+  void pipelineWorker();
+  void pipelineProcessFrame(PipelineFrame *pf, CryptSession *cryptsession) const;
 };
 
 inline bool FileDecryptor::ok() const
@@ -86,9 +155,75 @@ inline uint64_t FileDecryptor::total() const
 
 inline uint64_t FileDecryptor::curFilePos()
 {
+  if (d_pipelinestarted)
+    return d_pipelinefilepos;
+  return readPos();
+}
+
+inline uint64_t FileDecryptor::readPos()
+{
+  if (d_mappedfile)
+    return d_mappedpos;
   return d_file.tellg();
 }
 
+inline void FileDecryptor::skipData(uint64_t length)
+{
+  if (d_mappedfile)
+    d_mappedpos += length;
+  else
+    d_file.seekg(length, std::ios_base::cur);
+}
+
+// when mapped, *data points into the mapping, otherwise the data is read into
+// *buffer, which is (re)allocated to hold it
+inline bool FileDecryptor::getNextFrameBlock(unsigned char const **data, size_t length, std::unique_ptr<unsigned char[]> *buffer)
+{
+  if (d_mappedfile)
+  {
+    if (d_mappedpos + length > d_mappedfile->size()) [[unlikely]]
+      return false;
+    *data = d_mappedfile->data() + d_mappedpos;
+    d_mappedpos += length;
+    return true;
+  }
+  buffer->reset(new unsigned char[length]);
+  if (!getNextFrameBlock(buffer->get(), length)) [[unlikely]]
+    return false;
+  *data = buffer->get();
+  return true;
+}
+
+inline unsigned char *FileDecryptor::scratchBuffer(uint32_t size)
+{
+  if (size > d_scratchsize)
+  {
+    d_scratch.reset(new unsigned char[size]);
+    d_scratchsize = size;
+  }
+  return d_scratch.get();
+}
+
+inline uint64_t FileDecryptor::lastFramePos() const
+{
+  return d_lastframepos;
+}
+
+inline uint32_t FileDecryptor::lastFrameCounter() const
+{
+  return d_lastframecounter;
+}
+
+inline bool FileDecryptor::readFrameIndex(std::string const &filename, FrameIndex *index) const
+{
+  return index->read(filename, d_filesize, d_salt, d_salt_size, d_mackey, d_mackey_size);
+}
+
+inline bool FileDecryptor::writeFrameIndex(std::string const &filename, FrameIndex const &index) const
+{
+  return index.write(filename, d_filesize, d_salt, d_salt_size, d_mackey, d_mackey_size);
+}
+
 inline bool FileDecryptor::badMac() const
 {
   return d_badmac;
@@ -111,6 +246,14 @@ inline uint32_t FileDecryptor::getNextFrameBlockSize()
 inline bool FileDecryptor::getNextFrameBlock(unsigned char *data, size_t length)
 {
   //std::cout << "reading " << length << " bytes" << std::endl;
+  if (d_mappedfile)
+  {
+    if (d_mappedpos + length > d_mappedfile->size()) [[unlikely]]
+      return false;
+    std::memcpy(data, d_mappedfile->data() + d_mappedpos, length);
+    d_mappedpos += length;
+    return true;
+  }
   if (!d_file.read(reinterpret_cast<char *>(data), length))
     return false;
   return true;
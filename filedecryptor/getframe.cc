@@ -24,7 +24,10 @@ std::unique_ptr<BackupFrame> FileDecryptor::getFrame()
   if (d_backupfileversion == 0) [[unlikely]]
     return getFrameOld();
 
-  unsigned long long int filepos = d_file.tellg();
+  if (d_numthreads > 1 && !d_verbose && d_editattachments.empty())
+    return getFramePipelined();
+
+  unsigned long long int filepos = readPos();
 
   if (d_verbose) [[unlikely]]
     std::cout << "Getting frame at filepos: " << filepos << " (COUNTER: " << d_counter << ")" << std::endl;
@@ -37,45 +40,27 @@ std::unique_ptr<BackupFrame> FileDecryptor::getFrame()
 
   if (d_headerframe)
   {
+    d_lastframepos = 0;
+    d_lastframecounter = 0;
     std::unique_ptr<BackupFrame> frame(d_headerframe.release());
     return frame;
   }
 
+  d_lastframepos = filepos;
+  d_lastframecounter = d_counter;
+
   uint32_t encrypted_encryptedframelength = 0;
-  if (!d_file.read(reinterpret_cast<char *>(&encrypted_encryptedframelength), sizeof(decltype(encrypted_encryptedframelength)))) [[unlikely]]
+  if (!getNextFrameBlock(reinterpret_cast<unsigned char *>(&encrypted_encryptedframelength), sizeof(decltype(encrypted_encryptedframelength)))) [[unlikely]]
   {
     std::cout << "Failed to read " << sizeof(decltype(encrypted_encryptedframelength))
-              << " bytes from file to get next frame size... (" << d_file.tellg()
+              << " bytes from file to get next frame size... (" << static_cast<long long int>(readPos())
               << " / " << d_filesize << ")" << std::endl;
     return std::unique_ptr<BackupFrame>(nullptr);
   }
 
-  // set up context for caclulating MAC
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-  std::unique_ptr<EVP_MAC, decltype(&::EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, "hmac", nullptr), &::EVP_MAC_free);
-  std::unique_ptr<EVP_MAC_CTX, decltype(&::EVP_MAC_CTX_free)> hctx(EVP_MAC_CTX_new(mac.get()), &::EVP_MAC_CTX_free);
-  char digest[] = "SHA256";
-  OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string("digest", digest, 0), OSSL_PARAM_construct_end()};
-#else
-  std::unique_ptr<HMAC_CTX, decltype(&::HMAC_CTX_free)> hctx(HMAC_CTX_new(), &::HMAC_CTX_free);
-#endif
-
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-  if (EVP_MAC_init(hctx.get(), d_mackey, d_mackey_size, params) != 1) [[unlikely]]
-#else
-  if (HMAC_Init_ex(hctx.get(), d_mackey, d_mackey_size, EVP_sha256(), nullptr) != 1) [[unlikely]]
-#endif
-  {
-    std::cout << "Failed to initialize HMAC context" << std::endl;
-    return std::unique_ptr<BackupFrame>(nullptr);
-  }
-
   // update MAC with frame length
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-  if (EVP_MAC_update(hctx.get(), reinterpret_cast<unsigned char *>(&encrypted_encryptedframelength), sizeof(decltype(encrypted_encryptedframelength))) != 1) [[unlikely]]
-#else
-  if (HMAC_Update(hctx.get(), reinterpret_cast<unsigned char *>(&encrypted_encryptedframelength), sizeof(decltype(encrypted_encryptedframelength))) != 1) [[unlikely]]
-#endif
+  if (!d_cryptsession.macInit() ||
+      !d_cryptsession.macUpdate(reinterpret_cast<unsigned char *>(&encrypted_encryptedframelength), sizeof(decltype(encrypted_encryptedframelength)))) [[unlikely]]
   {
     std::cout << "Failed to update HMAC" << std::endl;
     return std::unique_ptr<BackupFrame>(nullptr);
@@ -83,22 +68,16 @@ std::unique_ptr<BackupFrame> FileDecryptor::getFrame()
 
   // decrypt encrypted_encryptedframelength
   uintToFourBytes(d_iv, d_counter++);
-
-  // create context
-  std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);  // disable padding
-  EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
-
-  if (EVP_DecryptInit_ex(ctx.get(), EVP_aes_256_ctr(), nullptr, d_cipherkey, d_iv) != 1) [[unlikely]]
+  if (!d_cryptsession.cipherInit(d_iv)) [[unlikely]]
   {
     std::cout << "CTX INIT FAILED" << std::endl;
     return 0;
   }
 
   uint32_t encryptedframelength = 0;
-  int encryptedframelength_size = sizeof(decltype(encryptedframelength));
-  if (EVP_DecryptUpdate(ctx.get(), reinterpret_cast<unsigned char *>(&encryptedframelength), &encryptedframelength_size,
-                        reinterpret_cast<unsigned char *>(&encrypted_encryptedframelength),
-                        sizeof(decltype(encrypted_encryptedframelength))) != 1) [[unlikely]]
+  if (!d_cryptsession.cipherUpdate(reinterpret_cast<unsigned char *>(&encryptedframelength),
+                                   reinterpret_cast<unsigned char *>(&encrypted_encryptedframelength),
+                                   sizeof(decltype(encrypted_encryptedframelength)))) [[unlikely]]
   {
     std::cout << "Failed to decrypt data" << std::endl;
     return 0;
@@ -119,47 +98,36 @@ std::unique_ptr<BackupFrame> FileDecryptor::getFrame()
     return std::unique_ptr<BackupFrame>(nullptr);
   }
 
-  // read in the encrypted frame data
-  std::unique_ptr<unsigned char[]> encryptedframe(new unsigned char[encryptedframelength]);
-
-  if (!getNextFrameBlock(encryptedframe.get(), encryptedframelength)) [[unlikely]]
+  // read in the encrypted frame data (or point into the mapped file)
+  std::unique_ptr<unsigned char[]> encryptedframebuffer;
+  unsigned char const *encryptedframe = nullptr;
+  if (!getNextFrameBlock(&encryptedframe, encryptedframelength, &encryptedframebuffer)) [[unlikely]]
   {
     std::cout << "Failed to read next frame (" << encryptedframelength << " bytes at filepos " << filepos << ")" << std::endl;
     return std::unique_ptr<BackupFrame>(nullptr);
   }
 
   // update MAC with read data
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-  if (EVP_MAC_update(hctx.get(), encryptedframe.get(), encryptedframelength - MACSIZE) != 1)
-#else
-  if (HMAC_Update(hctx.get(), encryptedframe.get(), encryptedframelength - MACSIZE) != 1)
-#endif
+  if (!d_cryptsession.macUpdate(encryptedframe, encryptedframelength - MACSIZE))
   {
     std::cout << "Failed to update HMAC" << std::endl;
     return std::unique_ptr<BackupFrame>(nullptr);
   }
 
   // finalize MAC
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-  unsigned long int digest_size = SHA256_DIGEST_LENGTH;
-  unsigned char hash[SHA256_DIGEST_LENGTH];
-  if (EVP_MAC_final(hctx.get(), hash, nullptr, digest_size) != 1)
-#else
-  unsigned int digest_size = SHA256_DIGEST_LENGTH;
   unsigned char hash[SHA256_DIGEST_LENGTH];
-  if (HMAC_Final(hctx.get(), hash, &digest_size) != 1)
-#endif
+  if (!d_cryptsession.macFinal(hash))
   {
     std::cout << "Failed to finalize MAC" << std::endl;
     return std::unique_ptr<BackupFrame>(nullptr);
   }
 
   // check MAC
-  if (std::memcmp(encryptedframe.get() + (encryptedframelength - MACSIZE), hash, 10) != 0) [[unlikely]]
+  if (std::memcmp(encryptedframe + (encryptedframelength - MACSIZE), hash, 10) != 0) [[unlikely]]
   {
     std::cout << "" << std::endl;
     std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Bad MAC in frame: theirMac: "
-              << bepaald::bytesToHexString(encryptedframe.get() + (encryptedframelength - MACSIZE), MACSIZE) << std::endl;
+              << bepaald::bytesToHexString(encryptedframe + (encryptedframelength - MACSIZE), MACSIZE) << std::endl;
     std::cout << "                              ourMac: " << bepaald::bytesToHexString(hash, SHA256_DIGEST_LENGTH) << std::endl;
 
     if (d_framecount == 1) [[unlikely]]
@@ -174,22 +142,21 @@ std::unique_ptr<BackupFrame> FileDecryptor::getFrame()
     if (d_verbose) [[unlikely]]
     {
       std::cout << "Calculated mac: " << bepaald::bytesToHexString(hash, SHA256_DIGEST_LENGTH) << std::endl;
-      std::cout << "Mac in file   : " << bepaald::bytesToHexString(encryptedframe.get() + (encryptedframelength - MACSIZE), MACSIZE) << std::endl;
+      std::cout << "Mac in file   : " << bepaald::bytesToHexString(encryptedframe + (encryptedframelength - MACSIZE), MACSIZE) << std::endl;
     }
   }
 
   // decode frame data
   int decodedframelength = encryptedframelength - MACSIZE;
-  unsigned char *decodedframe = new unsigned char[decodedframelength];
+  unsigned char *decodedframe = scratchBuffer(decodedframelength);
 
-  if (EVP_DecryptUpdate(ctx.get(), decodedframe, &decodedframelength, encryptedframe.get(), encryptedframelength - MACSIZE) != 1) [[unlikely]]
+  if (!d_cryptsession.cipherUpdate(decodedframe, encryptedframe, decodedframelength)) [[unlikely]]
   {
     std::cout << "Failed to decrypt data" << std::endl;
-    delete[] decodedframe;
     return std::unique_ptr<BackupFrame>(nullptr);
   }
 
-  delete[] encryptedframe.release(); // free up already....
+  encryptedframebuffer.reset(); // free up already....
 
   std::unique_ptr<BackupFrame> frame(initBackupFrame(decodedframe, decodedframelength, d_framecount++));
 
@@ -212,22 +179,17 @@ std::unique_ptr<BackupFrame> FileDecryptor::getFrame()
     if (d_badmac)
     {
       std::cout << "Encrypted data had failed verification (Bad MAC)" << std::endl;
-      delete[] decodedframe;
       return std::make_unique<InvalidFrame>();
     }
     else
     {
       std::cout << "Data was verified ok, but does not represent a valid frame... Don't know what happened, but it's bad... :(" << std::endl;
       std::cout << "Decrypted frame data: " << bepaald::bytesToHexString(decodedframe, decodedframelength) << std::endl;
-      delete[] decodedframe;
       return std::make_unique<InvalidFrame>();
     }
-    delete[] decodedframe;
     return std::unique_ptr<BackupFrame>(nullptr);
   }
 
-  delete[] decodedframe;
-
   uint32_t attsize = frame->attachmentSize();
   if (!d_badmac && attsize > 0 &&
       (frame->frameType() == BackupFrame::FRAMETYPE::ATTACHMENT ||
@@ -235,7 +197,8 @@ std::unique_ptr<BackupFrame> FileDecryptor::getFrame()
        frame->frameType() == BackupFrame::FRAMETYPE::STICKER))
   {
 
-    if ((d_file.tellg() < 0 && d_file.eof()) || (attsize + static_cast<uint64_t>(d_file.tellg()) > d_filesize)) [[unlikely]]
+    if ((d_mappedfile && attsize + d_mappedpos > d_filesize) ||
+        (!d_mappedfile && ((d_file.tellg() < 0 && d_file.eof()) || (attsize + static_cast<uint64_t>(d_file.tellg()) > d_filesize)))) [[unlikely]]
       if (!d_assumebadframesize)
       {
         std::cout << bepaald::bold_on << "ERROR" << bepaald::bold_off << " Unexpectedly hit end of file while reading attachment!" << std::endl;
@@ -244,9 +207,10 @@ std::unique_ptr<BackupFrame> FileDecryptor::getFrame()
 
     uintToFourBytes(d_iv, d_counter++);
 
-    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_mackey, d_mackey_size, d_cipherkey, d_cipherkey_size, attsize, d_filename, d_file.tellg());
+    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_mackey, d_mackey_size, d_cipherkey, d_cipherkey_size, attsize, d_filename, readPos());
+    reinterpret_cast<FrameWithAttachment *>(frame.get())->setMappedFile(d_mappedfile);
 
-    d_file.seekg(attsize + MACSIZE, std::ios_base::cur);
+    skipData(attsize + MACSIZE);
   }
 
   //std::cout << "FILEPOS: " << d_file.tellg() << std::endl;
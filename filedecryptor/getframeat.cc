@@ -0,0 +1,80 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+// random access to a frame, its position and iv counter as recorded in a FrameIndex
+std::unique_ptr<BackupFrame> FileDecryptor::getFrameAt(uint64_t filepos, uint32_t counter, uint64_t framenumber)
+{
+  // the headerframe was read by the constructor
+  if (filepos == 0)
+  {
+    if (d_headerframe)
+    {
+      d_lastframepos = 0;
+      d_lastframecounter = 0;
+      std::unique_ptr<BackupFrame> frame(d_headerframe.release());
+      return frame;
+    }
+    return std::unique_ptr<BackupFrame>(nullptr);
+  }
+
+  // a pipeline that has delivered all frames can be shut down
+  if (d_pipelinestarted && !d_stoppipeline)
+  {
+    bool pipelinefinished = false;
+    {
+      std::lock_guard<std::mutex> lock(d_pipelinemutex);
+      pipelinefinished = d_producerdone && d_pipeline.empty();
+    }
+    if (pipelinefinished)
+      stopPipeline();
+  }
+
+  bool pipelinerunning = d_pipelinestarted && !d_stoppipeline;
+  if (pipelinerunning || d_backupfileversion == 0) [[unlikely]]
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Random access to frames is not possible "
+              << (pipelinerunning ? "while reading sequentially" : "in this backup file version") << std::endl;
+    return std::unique_ptr<BackupFrame>(nullptr);
+  }
+
+  d_headerframe.reset();
+
+  // only seek when needed, seeking the stream discards its buffer
+  if (filepos != readPos())
+  {
+    if (d_mappedfile)
+      d_mappedpos = filepos;
+    else
+    {
+      d_file.clear();
+      d_file.seekg(filepos, std::ios_base::beg);
+    }
+  }
+  d_counter = counter;
+  d_framecount = framenumber;
+
+  // always read this single frame directly (not through the pipeline)
+  unsigned int numthreads = d_numthreads;
+  d_numthreads = 1;
+  std::unique_ptr<BackupFrame> frame(getFrame());
+  d_numthreads = numthreads;
+  return frame;
+}
@@ -0,0 +1,65 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+std::unique_ptr<BackupFrame> FileDecryptor::getFramePipelined()
+{
+  if (d_headerframe)
+  {
+    d_lastframepos = 0;
+    d_lastframecounter = 0;
+    std::unique_ptr<BackupFrame> frame(d_headerframe.release());
+    return frame;
+  }
+
+  if (!d_pipelinestarted) [[unlikely]]
+    startPipeline();
+
+  // get next frame (in order)
+  std::unique_ptr<PipelineFrame> pf;
+  {
+    std::unique_lock<std::mutex> lock(d_pipelinemutex);
+    d_framedonecv.wait(lock, [this](){ return (!d_pipeline.empty() && d_pipeline.front()->d_done) ||
+                                              (d_pipeline.empty() && d_producerdone); });
+    if (d_pipeline.empty()) [[unlikely]] // pipeline was stopped
+      return std::unique_ptr<BackupFrame>(nullptr);
+    pf = std::move(d_pipeline.front());
+    d_pipeline.pop_front();
+  }
+  d_spacecv.notify_one();
+
+  d_pipelinefilepos = pf->d_filepos;
+  d_lastframepos = pf->d_offset;
+  d_lastframecounter = pf->d_counter;
+  d_framecount = pf->d_framenumber + 1;
+
+  std::string messages(pf->d_messages.str());
+  if (!messages.empty()) [[unlikely]]
+    std::cout << messages << std::flush;
+
+  d_badmac = pf->d_badmac;
+  if (d_badmac || !pf->d_frame) [[unlikely]] // bad mac, error or end of file
+  {
+    stopPipeline();
+    return std::unique_ptr<BackupFrame>(nullptr);
+  }
+
+  return std::move(pf->d_frame);
+}
@@ -0,0 +1,32 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+// sets up frame to lazily read its attachment data from this backup file,
+// without reading the frame itself (used with a FrameIndex)
+void FileDecryptor::initLazyAttachment(FrameWithAttachment *frame, uint32_t counter, uint32_t attsize, uint64_t filepos) const
+{
+  std::unique_ptr<unsigned char[]> iv(new unsigned char[d_iv_size]);
+  std::memcpy(iv.get(), d_iv, d_iv_size);
+  uintToFourBytes(iv.get(), counter);
+
+  frame->setLazyData(iv.get(), d_iv_size, d_mackey, d_mackey_size, d_cipherkey, d_cipherkey_size, attsize, d_filename, filepos);
+  frame->setMappedFile(d_mappedfile);
+}
@@ -0,0 +1,88 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+// called from worker threads (and the producer): only touches *pf, the
+// thread's own cryptsession and (const) key material
+void FileDecryptor::pipelineProcessFrame(PipelineFrame *pf, CryptSession *cryptsession) const
+{
+  // calculate MAC over encrypted length + encrypted frame
+  unsigned char hash[SHA256_DIGEST_LENGTH];
+  if (!cryptsession->macInit() ||
+      !cryptsession->macUpdate(pf->d_encryptedlength, 4) ||
+      !cryptsession->macUpdate(pf->d_encryptedframedata, pf->d_encryptedframelength - MACSIZE) ||
+      !cryptsession->macFinal(hash)) [[unlikely]]
+  {
+    pf->d_messages << "Failed to calculate MAC" << std::endl;
+    return;
+  }
+
+  // check MAC
+  if (std::memcmp(pf->d_encryptedframedata + (pf->d_encryptedframelength - MACSIZE), hash, 10) != 0) [[unlikely]]
+  {
+    pf->d_messages << "" << std::endl;
+    pf->d_messages << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Bad MAC in frame: theirMac: "
+                   << bepaald::bytesToHexString(pf->d_encryptedframedata + (pf->d_encryptedframelength - MACSIZE), MACSIZE) << std::endl;
+    pf->d_messages << "                              ourMac: " << bepaald::bytesToHexString(hash, SHA256_DIGEST_LENGTH) << std::endl;
+
+    if (pf->d_framenumber == 1) [[unlikely]]
+      pf->d_messages << bepaald::bold_on << " *** NOTE : IT IS LIKELY AN INCORRECT PASSPHRASE WAS PROVIDED ***" << bepaald::bold_off << std::endl;
+
+    pf->d_badmac = true;
+    return;
+  }
+
+  // decode frame data, the first four bytes of the keystream were used for the framelength
+  std::unique_ptr<unsigned char[]> iv(new unsigned char[d_iv_size]);
+  std::memcpy(iv.get(), d_iv, d_iv_size);
+  uintToFourBytes(iv.get(), pf->d_counter);
+
+  // every thread decrypts into its own reusable buffer
+  thread_local std::unique_ptr<unsigned char[]> decodedframe;
+  thread_local int decodedframecapacity = 0;
+
+  unsigned char skip[4];
+  int decodedframelength = pf->d_encryptedframelength - MACSIZE;
+  if (decodedframelength > decodedframecapacity)
+  {
+    decodedframe.reset(new unsigned char[decodedframelength]);
+    decodedframecapacity = decodedframelength;
+  }
+  if (!cryptsession->cipherInit(iv.get()) ||
+      !cryptsession->cipherUpdate(skip, pf->d_encryptedlength, 4) ||
+      !cryptsession->cipherUpdate(decodedframe.get(), pf->d_encryptedframedata, decodedframelength)) [[unlikely]]
+  {
+    pf->d_messages << "Failed to decrypt data" << std::endl;
+    return;
+  }
+
+  pf->d_encryptedframe.reset(); // free up already....
+  pf->d_encryptedframedata = nullptr;
+
+  pf->d_frame.reset(initBackupFrame(decodedframe.get(), decodedframelength, pf->d_framenumber));
+
+  if (!pf->d_frame) [[unlikely]]
+  {
+    pf->d_messages << "Failed to get valid frame from decoded data..." << std::endl;
+    pf->d_messages << "Data was verified ok, but does not represent a valid frame... Don't know what happened, but it's bad... :(" << std::endl;
+    pf->d_messages << "Decrypted frame data: " << bepaald::bytesToHexString(decodedframe.get(), decodedframelength) << std::endl;
+    pf->d_frame = std::make_unique<InvalidFrame>();
+  }
+}
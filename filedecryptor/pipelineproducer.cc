@@ -0,0 +1,162 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+void FileDecryptor::pipelineProducer()
+{
+  // the producer works on its own copy of the iv/counter, every frame
+  // gets its counter stored, so the workers can set up their own iv's
+  std::unique_ptr<unsigned char[]> iv(new unsigned char[d_iv_size]);
+  std::memcpy(iv.get(), d_iv, d_iv_size);
+  uint32_t counter = d_counter;
+  uint64_t framecount = d_framecount;
+
+  CryptSession cryptsession;
+  {
+    std::lock_guard<std::mutex> lock(d_pipelinemutex);
+    cryptsession.initFrom(d_cryptsession);
+  }
+
+  bool last = false;
+  while (!last)
+  {
+    std::unique_ptr<PipelineFrame> pf(new PipelineFrame);
+    pf->d_framenumber = framecount;
+    pf->d_counter = 0;
+    pf->d_encryptedframelength = 0;
+    pf->d_encryptedframedata = nullptr;
+    pf->d_done = false;
+    pf->d_badmac = false;
+    pf->d_eof = false;
+
+    uint64_t filepos = readPos();
+    pf->d_offset = filepos;
+    last = true;
+
+    if (filepos == d_filesize) [[unlikely]]
+    {
+      pf->d_messages << "Read entire backup file..." << std::endl;
+      pf->d_eof = true;
+      pf->d_done = true;
+    }
+    else if (!getNextFrameBlock(pf->d_encryptedlength, 4)) [[unlikely]]
+    {
+      pf->d_messages << "Failed to read 4 bytes from file to get next frame size... (" << static_cast<long long int>(readPos())
+                     << " / " << d_filesize << ")" << std::endl;
+      pf->d_done = true;
+    }
+    else
+    {
+      // decrypt the framelength
+      pf->d_counter = counter++;
+      uintToFourBytes(iv.get(), pf->d_counter);
+
+      uint32_t encryptedframelength = 0;
+      if (!cryptsession.cipherInit(iv.get()) ||
+          !cryptsession.cipherUpdate(reinterpret_cast<unsigned char *>(&encryptedframelength), pf->d_encryptedlength, 4)) [[unlikely]]
+      {
+        pf->d_messages << "Failed to decrypt data" << std::endl;
+        pf->d_done = true;
+      }
+      else if ((encryptedframelength = bepaald::swap_endian<uint32_t>(encryptedframelength)) > 115343360 /*110MB*/ ||
+               encryptedframelength < 11) [[unlikely]]
+      {
+        pf->d_messages << "Failed to read next frame (" << encryptedframelength << " bytes at filepos " << filepos << ")" << std::endl;
+        if (framecount == 1)
+          pf->d_messages << bepaald::bold_on << " *** NOTE : IT IS LIKELY AN INCORRECT PASSPHRASE WAS PROVIDED ***" << bepaald::bold_off << std::endl;
+        pf->d_done = true;
+      }
+      else
+      {
+        pf->d_encryptedframelength = encryptedframelength;
+        if (!getNextFrameBlock(&pf->d_encryptedframedata, encryptedframelength, &pf->d_encryptedframe)) [[unlikely]]
+        {
+          pf->d_messages << "Failed to read next frame (" << encryptedframelength << " bytes at filepos " << filepos << ")" << std::endl;
+          pf->d_done = true;
+        }
+        else
+        {
+          // peek at the frametype. Frames with attachments are handled here: the position
+          // of the next frame (and its counter) depends on the attachment size
+          unsigned char head = 0;
+          cryptsession.cipherUpdate(&head, pf->d_encryptedframedata, 1);
+          int fieldnum = BackupFrame::getFieldnumber(head);
+          if (fieldnum == static_cast<int>(BackupFrame::FRAMETYPE::ATTACHMENT) ||
+              fieldnum == static_cast<int>(BackupFrame::FRAMETYPE::AVATAR) ||
+              fieldnum == static_cast<int>(BackupFrame::FRAMETYPE::STICKER))
+          {
+            pipelineProcessFrame(pf.get(), &cryptsession);
+            pf->d_done = true;
+
+            uint32_t attsize = 0;
+            if (pf->d_frame && !pf->d_badmac && (attsize = pf->d_frame->attachmentSize()) > 0 &&
+                (pf->d_frame->frameType() == BackupFrame::FRAMETYPE::ATTACHMENT ||
+                 pf->d_frame->frameType() == BackupFrame::FRAMETYPE::AVATAR ||
+                 pf->d_frame->frameType() == BackupFrame::FRAMETYPE::STICKER))
+            {
+              if ((d_mappedfile && attsize + d_mappedpos > d_filesize) ||
+                  (!d_mappedfile && ((d_file.tellg() < 0 && d_file.eof()) || (attsize + static_cast<uint64_t>(d_file.tellg()) > d_filesize)))) [[unlikely]]
+                if (!d_assumebadframesize)
+                {
+                  pf->d_messages << bepaald::bold_on << "ERROR" << bepaald::bold_off << " Unexpectedly hit end of file while reading attachment!" << std::endl;
+                  pf->d_frame.reset();
+                }
+
+              if (pf->d_frame) [[likely]]
+              {
+                uintToFourBytes(iv.get(), counter++);
+                reinterpret_cast<FrameWithAttachment *>(pf->d_frame.get())->setLazyData(iv.get(), d_iv_size, d_mackey, d_mackey_size, d_cipherkey, d_cipherkey_size, attsize, d_filename, readPos());
+                reinterpret_cast<FrameWithAttachment *>(pf->d_frame.get())->setMappedFile(d_mappedfile);
+                skipData(attsize + MACSIZE);
+                last = false;
+              }
+            }
+            else if (pf->d_frame && !pf->d_badmac)
+              last = false;
+          }
+          else
+            last = false;
+        }
+      }
+    }
+
+    ++framecount;
+    pf->d_filepos = (pf->d_eof || (!d_mappedfile && !d_file)) ? filepos : readPos();
+
+    bool work = !pf->d_done;
+    {
+      std::unique_lock<std::mutex> lock(d_pipelinemutex);
+      d_spacecv.wait(lock, [this](){ return d_stoppipeline || d_pipeline.size() < d_numthreads * s_pipelineframesperthread; });
+      if (d_stoppipeline)
+        return;
+      if (work)
+        d_pipelinework.push_back(pf.get());
+      d_pipeline.push_back(std::move(pf));
+      if (last)
+        d_producerdone = true;
+    }
+
+    if (work)
+      d_workcv.notify_one();
+    else
+      d_framedonecv.notify_one();
+  }
+  d_workcv.notify_all();
+}
@@ -0,0 +1,51 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+void FileDecryptor::pipelineWorker()
+{
+  // every worker gets its own copy of the (pre-keyed) crypto contexts
+  CryptSession cryptsession;
+  {
+    std::lock_guard<std::mutex> lock(d_pipelinemutex);
+    cryptsession.initFrom(d_cryptsession);
+  }
+
+  while (true)
+  {
+    PipelineFrame *pf = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(d_pipelinemutex);
+      d_workcv.wait(lock, [this](){ return d_stoppipeline || d_producerdone || !d_pipelinework.empty(); });
+      if (d_stoppipeline || d_pipelinework.empty()) // (producer done and no more work)
+        return;
+      pf = d_pipelinework.front();
+      d_pipelinework.pop_front();
+    }
+
+    pipelineProcessFrame(pf, &cryptsession);
+
+    {
+      std::lock_guard<std::mutex> lock(d_pipelinemutex);
+      pf->d_done = true;
+    }
+    d_framedonecv.notify_one();
+  }
+}
@@ -0,0 +1,41 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+void FileDecryptor::stopPipeline()
+{
+  {
+    std::lock_guard<std::mutex> lock(d_pipelinemutex);
+    d_stoppipeline = true;
+  }
+  d_spacecv.notify_all();
+  d_workcv.notify_all();
+
+  if (d_producer.joinable())
+    d_producer.join();
+  for (auto &w : d_workers)
+    if (w.joinable())
+      w.join();
+  d_workers.clear();
+
+  d_pipelinework.clear();
+  d_pipeline.clear();
+  d_producerdone = true;
+}
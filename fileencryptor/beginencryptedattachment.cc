@@ -0,0 +1,47 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "fileencryptor.ih"
+
+// starts the encryption of attachment data into the staging buffer. The data is passed
+// (in any number of blocks) to writeEncryptedAttachmentBlock(), finishEncryptedAttachment()
+// appends the mac
+bool FileEncryptor::beginEncryptedAttachment()
+{
+  if (!d_ok)
+    return false;
+
+  if (d_stagingcapacity == 0)
+  {
+    d_stagingcapacity = s_stagingsize;
+    d_staging.reset(new unsigned char[d_stagingcapacity]);
+  }
+
+  // update iv:
+  uintToFourBytes(d_iv, d_counter++);
+
+  if (!d_cryptsession.cipherInit(d_iv) ||
+      !d_cryptsession.macInit() ||
+      !d_cryptsession.macUpdate(d_iv, d_iv_size))
+  {
+    std::cout << "CTX INIT FAILED" << std::endl;
+    return false;
+  }
+  return true;
+}
@@ -24,67 +24,44 @@ std::pair<unsigned char *, uint64_t> FileEncryptor::encryptAttachment(unsigned c
   if (!d_ok)
     return {nullptr, 0};
 
+  std::unique_ptr<unsigned char[]> encryptedframe(new unsigned char[length + MACSIZE]);
+
   // update iv:
   uintToFourBytes(d_iv, d_counter++);
 
-  // encryption context
-  std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);
+  if (!encryptAttachment(data, length, encryptedframe.get(), d_iv, &d_cryptsession))
+    return {nullptr, 0};
 
-  // disable padding
-  EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
+  return {encryptedframe.release(), length + MACSIZE};
+}
 
-  if (EVP_EncryptInit_ex(ctx.get(), EVP_aes_256_ctr(), nullptr, d_cipherkey, d_iv) != 1)
+// encrypts the attachment into out (length + MACSIZE bytes), with the given iv and (keyed)
+// crypto contexts. Does not touch any members, so may be called from pipeline workers
+bool FileEncryptor::encryptAttachment(unsigned char const *data, uint64_t length, unsigned char *out, unsigned char const *iv,
+                                      CryptSession *cryptsession) const
+{
+  if (!cryptsession->cipherInit(iv))
   {
     std::cout << "CTX INIT FAILED" << std::endl;
-    return {nullptr, 0};
+    return false;
   }
-
-  std::unique_ptr<unsigned char[]> encryptedframe(new unsigned char[length + MACSIZE]);
-  int l = static_cast<int>(length);
-  if (EVP_EncryptUpdate(ctx.get(), encryptedframe.get(), &l, data, length) != 1)
+  if (!cryptsession->cipherUpdate(out, data, length))
   {
     std::cout << "ENCRYPT FAILED" << std::endl;
-    return {nullptr, 0};
+    return false;
   }
 
   // calc mac
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-  unsigned long int digest_size = SHA256_DIGEST_LENGTH;
   unsigned char hash[SHA256_DIGEST_LENGTH];
-  std::unique_ptr<EVP_MAC, decltype(&::EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, "hmac", nullptr), &::EVP_MAC_free);
-  std::unique_ptr<EVP_MAC_CTX, decltype(&::EVP_MAC_CTX_free)> hctx(EVP_MAC_CTX_new(mac.get()), &::EVP_MAC_CTX_free);
-  char digest[] = "SHA256";
-  OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string("digest", digest, 0), OSSL_PARAM_construct_end()};
-  if (EVP_MAC_init(hctx.get(), d_mackey, d_mackey_size, params) != 1)
-  {
-    std::cout << "Failed to initialize HMAC" << std::endl;
-    return {nullptr, 0};
-  }
-  if (EVP_MAC_update(hctx.get(), d_iv, d_iv_size) != 1 ||
-      EVP_MAC_update(hctx.get(), encryptedframe.get(), length) != 1 ||
-      EVP_MAC_final(hctx.get(), hash, nullptr, digest_size) != 1)
+  if (!cryptsession->macInit() ||
+      !cryptsession->macUpdate(iv, d_iv_size) ||
+      !cryptsession->macUpdate(out, length) ||
+      !cryptsession->macFinal(hash))
   {
     std::cout << "Failed to update/finalize hmac" << std::endl;
-    return {nullptr, 0};
-  }
-#else
-  unsigned int digest_size = SHA256_DIGEST_LENGTH;
-  unsigned char hash[SHA256_DIGEST_LENGTH];
-  std::unique_ptr<HMAC_CTX, decltype(&::HMAC_CTX_free)> hctx(HMAC_CTX_new(), &::HMAC_CTX_free);
-  if (HMAC_Init_ex(hctx.get(), d_mackey, d_mackey_size, EVP_sha256(), nullptr) != 1)
-  {
-    std::cout << "Failed to initialize HMAC context" << std::endl;
-    return {nullptr, 0};
+    return false;
   }
-  if (HMAC_Update(hctx.get(), d_iv, d_iv_size) != 1 ||
-      HMAC_Update(hctx.get(), encryptedframe.get(), length) != 1 ||
-      HMAC_Final(hctx.get(), hash, &digest_size) != 1)
-  {
-    std::cout << "Failed to update/finalize hmac" << std::endl;
-    return {nullptr, 0};
-  }
-#endif
-  std::memcpy(encryptedframe.get() + length, hash, 10);
+  std::memcpy(out + length, hash, 10);
 
-  return {encryptedframe.release(), length + MACSIZE};
+  return true;
 }
@@ -29,64 +29,71 @@ std::pair<unsigned char *, uint64_t> FileEncryptor::encryptFrame(unsigned char *
   if (!d_ok)
     return {nullptr, 0};
 
+  std::unique_ptr<unsigned char[]> encryptedframe(new unsigned char[encryptedFrameSize(length)]);
+
   // update iv:
   uintToFourBytes(d_iv, d_counter++);
 
-  // encryption context
-  std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);
+  if (!encryptFrame(data, length, encryptedframe.get(), d_iv, &d_cryptsession))
+    return {nullptr, 0};
 
-  // disable padding
-  EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
+  return {encryptedframe.release(), encryptedFrameSize(length)};
+}
 
-  if (EVP_EncryptInit_ex(ctx.get(), EVP_aes_256_ctr(), nullptr, d_cipherkey, d_iv) != 1)
+// encrypts the frame into out (encryptedFrameSize(length) bytes), data may be out + 4 to
+// encrypt in place. Uses the given iv and (keyed) crypto contexts and does not touch any
+// members, so may be called from pipeline workers
+bool FileEncryptor::encryptFrame(unsigned char const *data, uint64_t length, unsigned char *out, unsigned char const *iv,
+                                 CryptSession *cryptsession) const
+{
+  if (!cryptsession->cipherInit(iv))
   {
     std::cout << "CTX INIT FAILED" << std::endl;
-    return {nullptr, 0};
+    return false;
   }
 
-  std::unique_ptr<unsigned char[]> encryptedframe(new unsigned char[sizeof(uint32_t) + length + MACSIZE]);
-
   int encryptedframepos = 0;
   // in newer backup file versions, the length is encrypted
   if (d_backupfileversion >= 1) [[likely]]
   {
-    int l = static_cast<int>(sizeof(uint32_t) + length);
     uint32_t length_data = bepaald::swap_endian<uint32_t>(length + MACSIZE);
 
     //std::cout << "Encrypting length data: " << length_data << " -> ";
 
-    if (EVP_EncryptUpdate(ctx.get(), encryptedframe.get(), &l, reinterpret_cast<unsigned char *>(&length_data), sizeof(uint32_t)) != 1)
+    if (!cryptsession->cipherUpdate(out, reinterpret_cast<unsigned char *>(&length_data), sizeof(uint32_t)))
     {
       std::cout << "ENCRYPT FAILED" << std::endl;
-      return {nullptr, 0};
+      return false;
     }
-    encryptedframepos = l;
-    //std::cout << bepaald::bytesToHexString(reinterpret_cast<unsigned char *>(encryptedframe.get()), 4) << std::endl;
+    encryptedframepos = sizeof(uint32_t);
+    //std::cout << bepaald::bytesToHexString(reinterpret_cast<unsigned char *>(out), 4) << std::endl;
   }
   else [[unlikely]] // old backup file format, had RAW frame length
   {
     uint32_t rawlength = bepaald::swap_endian<uint32_t>(length + MACSIZE);
-    std::memcpy(encryptedframe.get(), reinterpret_cast<unsigned char *>(&rawlength), 4);
+    std::memcpy(out, reinterpret_cast<unsigned char *>(&rawlength), 4);
     encryptedframepos = 4;
   }
 
-  int l = static_cast<int>(length);
-  if (EVP_EncryptUpdate(ctx.get(), encryptedframe.get() + encryptedframepos, &l, data, length) != 1)
+  if (!cryptsession->cipherUpdate(out + encryptedframepos, data, length))
   {
     std::cout << "ENCRYPT FAILED" << std::endl;
-    return {nullptr, 0};
+    return false;
   }
 
   // calc mac
-  unsigned int digest_size = SHA256_DIGEST_LENGTH;
   unsigned char hash[SHA256_DIGEST_LENGTH];
-  HMAC(EVP_sha256(), d_mackey, d_mackey_size,
-       encryptedframe.get() + (d_backupfileversion >= 1 ? 0 : sizeof(uint32_t)),
-       length + (d_backupfileversion >= 1 ? sizeof(uint32_t) : 0),
-       hash, &digest_size);
-  std::memcpy(encryptedframe.get() + sizeof(uint32_t) + length, hash, 10);
+  if (!cryptsession->macInit() ||
+      !cryptsession->macUpdate(out + (d_backupfileversion >= 1 ? 0 : sizeof(uint32_t)),
+                               length + (d_backupfileversion >= 1 ? sizeof(uint32_t) : 0)) ||
+      !cryptsession->macFinal(hash))
+  {
+    std::cout << "Failed to update/finalize hmac" << std::endl;
+    return false;
+  }
+  std::memcpy(out + sizeof(uint32_t) + length, hash, 10);
 
   //std::cout << "                                   : " << bepaald::bytesToHexString(hash, digest_size) << std::endl;
 
-  return {encryptedframe.release(), sizeof(uint32_t) + length + MACSIZE};
+  return true;
 }
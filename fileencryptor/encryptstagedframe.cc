@@ -0,0 +1,37 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "fileencryptor.ih"
+
+// encrypts (in place) the frame that was just serialized into stagingBuffer(length)
+bool FileEncryptor::encryptStagedFrame(uint64_t length)
+{
+  if (!d_ok)
+    return false;
+
+  // update iv:
+  uintToFourBytes(d_iv, d_counter++);
+
+  unsigned char *frame = d_staging.get() + d_stagingused;
+  if (!encryptFrame(frame + sizeof(uint32_t), length, frame, d_iv, &d_cryptsession))
+    return false;
+
+  d_stagingused += encryptedFrameSize(length);
+  return true;
+}
@@ -22,7 +22,14 @@
 FileEncryptor::FileEncryptor(std::string const &passphrase, unsigned char *salt, uint64_t salt_size, unsigned char *iv, uint64_t iv_size, uint32_t backupfileversion)
   :
   d_passphrase(passphrase),
-  d_backupfileversion(backupfileversion)
+  d_backupfileversion(backupfileversion),
+  d_outputfile(nullptr),
+  d_stagingcapacity(0),
+  d_stagingused(0),
+  d_numthreads(1),
+  d_pipelineinflight(0),
+  d_pipelinestarted(false),
+  d_stoppipeline(false)
 {
   d_ok = init(salt, salt_size, iv, iv_size);
 }
@@ -30,10 +37,25 @@ FileEncryptor::FileEncryptor(std::string const &passphrase, unsigned char *salt,
 FileEncryptor::FileEncryptor(std::string const &passphrase, uint32_t backupfileversion)
   :
   d_passphrase(passphrase),
-  d_backupfileversion(backupfileversion)
+  d_backupfileversion(backupfileversion),
+  d_outputfile(nullptr),
+  d_stagingcapacity(0),
+  d_stagingused(0),
+  d_numthreads(1),
+  d_pipelineinflight(0),
+  d_pipelinestarted(false),
+  d_stoppipeline(false)
 {}
 
 FileEncryptor::FileEncryptor()
+  :
+  d_outputfile(nullptr),
+  d_stagingcapacity(0),
+  d_stagingused(0),
+  d_numthreads(1),
+  d_pipelineinflight(0),
+  d_pipelinestarted(false),
+  d_stoppipeline(false)
 {}
 
 bool FileEncryptor::init(std::string const &passphrase, unsigned char *salt, uint64_t salt_size, unsigned char *iv, uint64_t iv_size, uint32_t backupfileversion)
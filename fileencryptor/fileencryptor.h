@@ -22,6 +22,14 @@
 
 #include <cstring>
 #include <utility>
+#include <fstream>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include "../cryptbase/cryptbase.h"
 #include "../common_be.h"
@@ -30,20 +38,101 @@ class FileEncryptor : public CryptBase
 {
   std::string d_passphrase;
   uint32_t d_backupfileversion;
+  std::ofstream *d_outputfile;
+
+  // staged output (sequential writing): frames are serialized straight into d_staging, encrypted
+  // in place and written to d_outputfile when the buffer is full (or flushStaging() is called)
+  std::unique_ptr<unsigned char[]> d_staging;
+  uint64_t d_stagingcapacity;
+  uint64_t d_stagingused;
+  static uint64_t constexpr s_stagingsize = 4 * 1024 * 1024;
+
+  // pipelined encryption (after startPipeline()): frames get their iv counter(s) when they
+  // are added (in order), d_numthreads workers encrypt them out of order, and the thread
+  // adding the frames writes them to d_outputfile in order. The frames in the pipeline
+  // (plain + encrypted data) take at most s_pipelinemaxinflight bytes (or one frame).
+  struct PipelineFrame
+  {
+    uint32_t d_counter;
+    std::unique_ptr<unsigned char[]> d_framedata;           // plaintext frame
+    uint64_t d_framedatasize;
+    unsigned char const *d_attachmentdata;                  // not owned, must stay valid until written
+    uint64_t d_attachmentdatasize;
+    std::unique_ptr<unsigned char[]> d_encryptedframe;
+    uint64_t d_encryptedframesize;
+    std::unique_ptr<unsigned char[]> d_encryptedattachment;
+    uint64_t d_encryptedattachmentsize;
+    std::function<void()> d_onwritten;                      // eg, to drop the attachment data
+    uint64_t d_size;
+    bool d_done;
+  };
+  unsigned int d_numthreads;
+  std::vector<std::thread> d_workers;
+  std::mutex d_pipelinemutex;
+  std::condition_variable d_framedonecv;      // writer waits for the oldest frame
+  std::condition_variable d_workcv;           // workers wait for work
+  std::deque<std::unique_ptr<PipelineFrame>> d_pipeline;
+  std::deque<PipelineFrame *> d_pipelinework;
+  uint64_t d_pipelineinflight;
+  bool d_pipelinestarted;
+  bool d_stoppipeline;
+  static uint64_t constexpr s_pipelinemaxinflight = 64 * 1024 * 1024;
+
  public:
   FileEncryptor(std::string const &passphrase, unsigned char *salt, uint64_t salt_size, unsigned char *iv, uint64_t iv_size, uint32_t backupfileversion);
   explicit FileEncryptor(std::string const &passphrase, uint32_t backupfileversion);
   FileEncryptor();
   FileEncryptor(FileEncryptor const &other) = delete;
   FileEncryptor operator=(FileEncryptor const &other) = delete;
+  ~FileEncryptor();
   bool init(std::string const &passphrase, unsigned char *salt, uint64_t salt_size, unsigned char *iv, uint64_t iv_size, uint32_t backupfileversion);
   bool init(unsigned char *salt, uint64_t salt_size, unsigned char *iv, uint64_t iv_size);
   std::pair<unsigned char *, uint64_t> encryptFrame(std::pair<unsigned char *, uint64_t> const &data);
   std::pair<unsigned char *, uint64_t> encryptFrame(unsigned char *data, uint64_t length);
   std::pair<unsigned char *, uint64_t> encryptAttachment(unsigned char *data, uint64_t length);
+  inline void setOutputFile(std::ofstream *outputfile);
+  unsigned char *stagingBuffer(uint64_t length);
+  bool encryptStagedFrame(uint64_t length);
+  bool writeEncryptedAttachment(unsigned char const *data, uint64_t length);
+  bool beginEncryptedAttachment();
+  bool writeEncryptedAttachmentBlock(unsigned char const *data, uint64_t length);
+  bool finishEncryptedAttachment();
+  bool flushStaging();
+  bool startPipeline(unsigned int numthreads);
+  bool pipelineAddFrame(unsigned char *framedata, uint64_t length, unsigned char const *attachmentdata = nullptr,
+                        uint64_t attachmentlength = 0, std::function<void()> onwritten = std::function<void()>());
+  bool drainPipeline();
+  bool finishPipeline();
+  void stopPipeline();
+  inline bool pipelineStarted() const;
+  inline static uint64_t encryptedFrameSize(uint64_t length);
  private:
+  bool encryptFrame(unsigned char const *data, uint64_t length, unsigned char *out, unsigned char const *iv,
+                    CryptSession *cryptsession) const;
+  bool encryptAttachment(unsigned char const *data, uint64_t length, unsigned char *out, unsigned char const *iv,
+                         CryptSession *cryptsession) const;
+  void pipelineWorker();
+  bool pipelineWriteFrames(bool wait);
   //bool getCipherAndMac(uint hashoutputsize, uint outputsize); // MOVE TO BASE
   //bool getBackupKey(std::string const &passphrase);           // MOVE TO BASE
 };
 
+inline bool FileEncryptor::pipelineStarted() const
+{
+  return d_pipelinestarted;
+}
+
+// size of a frame as written to file: its (encrypted) length, data and mac
+inline uint64_t FileEncryptor::encryptedFrameSize(uint64_t length) // static
+{
+  return sizeof(uint32_t) + length + MACSIZE;
+}
+
+// sets the file staged and pipelined output is written to
+inline void FileEncryptor::setOutputFile(std::ofstream *outputfile)
+{
+  d_outputfile = outputfile;
+  d_stagingused = 0;
+}
+
 #endif
@@ -0,0 +1,35 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "fileencryptor.ih"
+
+// writes the staged (encrypted) frames to the output file
+bool FileEncryptor::flushStaging()
+{
+  if (d_stagingused == 0)
+    return true;
+
+  if (!d_outputfile || !d_outputfile->write(reinterpret_cast<char *>(d_staging.get()), d_stagingused))
+  {
+    std::cout << "Failed to write encrypted frame data to file" << std::endl;
+    return false;
+  }
+  d_stagingused = 0;
+  return true;
+}
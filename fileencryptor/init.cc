@@ -50,6 +50,12 @@ bool FileEncryptor::init(unsigned char *salt, uint64_t salt_size, unsigned char
     return false;
   }
 
+  if (!d_cryptsession.init(d_mackey, d_mackey_size, "SHA256", d_cipherkey, d_cipherkey_size, EVP_aes_256_ctr(), true))
+  {
+    std::cout << "Failed to set up crypto contexts" << std::endl;
+    return false;
+  }
+
   DEBUGOUT("IV: ", bepaald::bytesToHexString(d_iv, d_iv_size));
   DEBUGOUT("SALT: ", bepaald::bytesToHexString(d_salt, d_salt_size));
   DEBUGOUT("BACKUPKEY: ", bepaald::bytesToHexString(d_backupkey, d_backupkey_size));
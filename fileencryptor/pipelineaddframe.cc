@@ -0,0 +1,64 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "fileencryptor.ih"
+
+// takes ownership of framedata. The frame (and its attachment) get the next iv counter(s)
+// now, so the output is identical to encrypting them sequentially. The attachment data
+// is not copied, it must stay valid until the frame is written, after which onwritten
+// is called.
+bool FileEncryptor::pipelineAddFrame(unsigned char *framedata, uint64_t length, unsigned char const *attachmentdata,
+                                     uint64_t attachmentlength, std::function<void()> onwritten)
+{
+  std::unique_ptr<PipelineFrame> pf(new PipelineFrame);
+  pf->d_framedata.reset(framedata);
+  pf->d_framedatasize = length;
+  pf->d_attachmentdata = attachmentdata;
+  pf->d_attachmentdatasize = attachmentdata ? attachmentlength : 0;
+  pf->d_encryptedframesize = 0;
+  pf->d_encryptedattachmentsize = 0;
+  pf->d_onwritten = std::move(onwritten);
+  pf->d_done = false;
+
+  if (!d_ok || !d_pipelinestarted) [[unlikely]]
+    return false;
+
+  pf->d_counter = d_counter++;
+  if (pf->d_attachmentdata)
+    ++d_counter;
+
+  // plaintext + encrypted data (the attachment data is counted too, it is kept alive for the pipeline)
+  pf->d_size = 2 * (pf->d_framedatasize + pf->d_attachmentdatasize) + sizeof(uint32_t) + 2 * MACSIZE;
+
+  // make room: write what is finished, then wait for the oldest frames until it fits
+  if (!pipelineWriteFrames(false))
+    return false;
+  while (d_pipelineinflight > 0 && d_pipelineinflight + pf->d_size > s_pipelinemaxinflight)
+    if (!pipelineWriteFrames(true))
+      return false;
+
+  d_pipelineinflight += pf->d_size;
+  {
+    std::lock_guard<std::mutex> lock(d_pipelinemutex);
+    d_pipelinework.push_back(pf.get());
+    d_pipeline.push_back(std::move(pf));
+  }
+  d_workcv.notify_one();
+  return true;
+}
@@ -0,0 +1,67 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "fileencryptor.ih"
+
+void FileEncryptor::pipelineWorker()
+{
+  // every worker gets its own copy of the (pre-keyed) crypto contexts and iv
+  CryptSession cryptsession;
+  std::unique_ptr<unsigned char[]> iv(new unsigned char[d_iv_size]);
+  {
+    std::lock_guard<std::mutex> lock(d_pipelinemutex);
+    cryptsession.initFrom(d_cryptsession);
+    std::memcpy(iv.get(), d_iv, d_iv_size);
+  }
+
+  while (true)
+  {
+    PipelineFrame *pf = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(d_pipelinemutex);
+      d_workcv.wait(lock, [this](){ return d_stoppipeline || !d_pipelinework.empty(); });
+      if (d_stoppipeline)
+        return;
+      pf = d_pipelinework.front();
+      d_pipelinework.pop_front();
+    }
+
+    uintToFourBytes(iv.get(), pf->d_counter);
+    pf->d_encryptedframesize = encryptedFrameSize(pf->d_framedatasize);
+    pf->d_encryptedframe.reset(new unsigned char[pf->d_encryptedframesize]);
+    if (!encryptFrame(pf->d_framedata.get(), pf->d_framedatasize, pf->d_encryptedframe.get(), iv.get(), &cryptsession)) [[unlikely]]
+      pf->d_encryptedframe.reset();
+    pf->d_framedata.reset();
+
+    if (pf->d_attachmentdata && pf->d_encryptedframe)
+    {
+      uintToFourBytes(iv.get(), pf->d_counter + 1);
+      pf->d_encryptedattachmentsize = pf->d_attachmentdatasize + MACSIZE;
+      pf->d_encryptedattachment.reset(new unsigned char[pf->d_encryptedattachmentsize]);
+      if (!encryptAttachment(pf->d_attachmentdata, pf->d_attachmentdatasize, pf->d_encryptedattachment.get(), iv.get(), &cryptsession)) [[unlikely]]
+        pf->d_encryptedattachment.reset();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(d_pipelinemutex);
+      pf->d_done = true;
+    }
+    d_framedonecv.notify_one();
+  }
+}
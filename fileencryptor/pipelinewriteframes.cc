@@ -0,0 +1,58 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "fileencryptor.ih"
+
+// writes the finished frames at the front of the pipeline to the output file, in
+// order. If wait is set, this waits for the first frame to finish.
+bool FileEncryptor::pipelineWriteFrames(bool wait)
+{
+  while (true)
+  {
+    std::unique_ptr<PipelineFrame> pf;
+    {
+      std::unique_lock<std::mutex> lock(d_pipelinemutex);
+      if (wait)
+        d_framedonecv.wait(lock, [this](){ return d_pipeline.empty() || d_pipeline.front()->d_done; });
+      if (d_pipeline.empty() || !d_pipeline.front()->d_done)
+        return true;
+      pf = std::move(d_pipeline.front());
+      d_pipeline.pop_front();
+    }
+    wait = false;
+    d_pipelineinflight -= pf->d_size;
+
+    if (!pf->d_encryptedframe || (pf->d_attachmentdata && !pf->d_encryptedattachment)) [[unlikely]]
+    {
+      std::cout << "Failed to encrypt framedata" << std::endl;
+      return false;
+    }
+
+    if (!d_outputfile->write(reinterpret_cast<char *>(pf->d_encryptedframe.get()), pf->d_encryptedframesize) ||
+        (pf->d_encryptedattachment &&
+         !d_outputfile->write(reinterpret_cast<char *>(pf->d_encryptedattachment.get()), pf->d_encryptedattachmentsize))) [[unlikely]]
+    {
+      std::cout << "Failed to write encrypted frame data to file" << std::endl;
+      return false;
+    }
+
+    if (pf->d_onwritten)
+      pf->d_onwritten();
+  }
+}
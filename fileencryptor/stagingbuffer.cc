@@ -0,0 +1,39 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "fileencryptor.ih"
+
+// returns room for the plaintext of the next frame (length bytes) in the staging buffer,
+// flushing the buffer first if needed. The caller serializes the frame into it, and then
+// calls encryptStagedFrame(length)
+unsigned char *FileEncryptor::stagingBuffer(uint64_t length)
+{
+  uint64_t needed = encryptedFrameSize(length);
+  if (d_stagingused + needed > d_stagingcapacity)
+  {
+    if (!flushStaging())
+      return nullptr;
+    if (needed > d_stagingcapacity)
+    {
+      d_stagingcapacity = std::max(needed, s_stagingsize);
+      d_staging.reset(new unsigned char[d_stagingcapacity]);
+    }
+  }
+  return d_staging.get() + d_stagingused + sizeof(uint32_t);
+}
@@ -0,0 +1,44 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "fileencryptor.ih"
+
+// encrypts the next block of attachment data into the staging buffer, flushing it
+// whenever it is full
+bool FileEncryptor::writeEncryptedAttachmentBlock(unsigned char const *data, uint64_t length)
+{
+  uint64_t pos = 0;
+  while (pos < length)
+  {
+    if (d_stagingused == d_stagingcapacity && !flushStaging())
+      return false;
+
+    uint64_t blocksize = std::min(length - pos, d_stagingcapacity - d_stagingused);
+    unsigned char *out = d_staging.get() + d_stagingused;
+    if (!d_cryptsession.cipherUpdate(out, data + pos, blocksize) ||
+        !d_cryptsession.macUpdate(out, blocksize))
+    {
+      std::cout << "ENCRYPT FAILED" << std::endl;
+      return false;
+    }
+    d_stagingused += blocksize;
+    pos += blocksize;
+  }
+  return true;
+}
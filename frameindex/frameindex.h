@@ -0,0 +1,103 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef FRAMEINDEX_H_
+#define FRAMEINDEX_H_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Sidecar index of a backup file, written after a full read. For every frame it
+// records the position, IV counter, frame type, target table (for INSERT statements)
+// and attachment info, so later runs can seek straight to the frames they need.
+// The index is tied to its backup by file size and header salt, and authenticated
+// with the backup's own MAC key.
+class FrameIndex
+{
+ public:
+  struct Entry
+  {
+    uint64_t offset;           // filepos of the frame
+    uint64_t attachmentoffset; // filepos of attachment data (frames with attachment)
+    uint64_t rowid;            // attachment frames only
+    uint64_t uniqueid;         // attachment frames only
+    uint32_t counter;          // iv counter of the frame
+    uint32_t attachmentsize;   // frames with attachment
+    uint32_t frametype;
+    std::string table;         // INSERT statements only
+  };
+
+ private:
+  std::vector<Entry> d_entries;
+  static uint32_t constexpr s_version = 2;
+
+ public:
+  inline void add(Entry &&entry);
+  inline std::vector<Entry> const &entries() const;
+  inline void clear();
+  bool read(std::string const &filename, uint64_t filesize, unsigned char const *salt, uint64_t salt_size,
+            unsigned char const *mackey, uint64_t mackey_size);
+  bool write(std::string const &filename, uint64_t filesize, unsigned char const *salt, uint64_t salt_size,
+             unsigned char const *mackey, uint64_t mackey_size) const;
+
+ private:
+  template <typename T>
+  inline static void append(std::vector<unsigned char> *data, T value);
+  template <typename T>
+  inline static bool extract(std::vector<unsigned char> const &data, uint64_t *pos, T *value);
+};
+
+inline void FrameIndex::add(Entry &&entry)
+{
+  d_entries.emplace_back(std::move(entry));
+}
+
+inline std::vector<FrameIndex::Entry> const &FrameIndex::entries() const
+{
+  return d_entries;
+}
+
+inline void FrameIndex::clear()
+{
+  d_entries.clear();
+}
+
+// integers are stored little endian
+template <typename T>
+inline void FrameIndex::append(std::vector<unsigned char> *data, T value) // static
+{
+  for (unsigned int i = 0; i < sizeof(T); ++i)
+    data->push_back(static_cast<unsigned char>((static_cast<uint64_t>(value) >> (8 * i)) & 0xff));
+}
+
+template <typename T>
+inline bool FrameIndex::extract(std::vector<unsigned char> const &data, uint64_t *pos, T *value) // static
+{
+  if (*pos + sizeof(T) > data.size())
+    return false;
+  uint64_t v = 0;
+  for (unsigned int i = 0; i < sizeof(T); ++i)
+    v |= static_cast<uint64_t>(data[*pos + i]) << (8 * i);
+  *value = static_cast<T>(v);
+  *pos += sizeof(T);
+  return true;
+}
+
+#endif
@@ -0,0 +1,97 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "frameindex.ih"
+
+// returns false (and leaves the index empty) if the file can not be read, is
+// corrupt or does not belong to the backup identified by filesize and salt
+bool FrameIndex::read(std::string const &filename, uint64_t filesize, unsigned char const *salt, uint64_t salt_size,
+                      unsigned char const *mackey, uint64_t mackey_size)
+{
+  d_entries.clear();
+
+  std::ifstream file(filename, std::ios_base::binary | std::ios_base::in);
+  if (!file.is_open())
+  {
+    std::cout << "Failed to open frame index '" << filename << "'" << std::endl;
+    return false;
+  }
+  std::vector<unsigned char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  // check MAC
+  if (data.size() < STRLEN(FRAMEINDEX_MAGIC) + SHA256_DIGEST_LENGTH ||
+      std::memcmp(data.data(), FRAMEINDEX_MAGIC, STRLEN(FRAMEINDEX_MAGIC)) != 0)
+  {
+    std::cout << "File '" << filename << "' is not a frame index" << std::endl;
+    return false;
+  }
+  uint64_t datasize = data.size() - SHA256_DIGEST_LENGTH;
+  unsigned int digest_size = SHA256_DIGEST_LENGTH;
+  unsigned char hash[SHA256_DIGEST_LENGTH];
+  if (!HMAC(EVP_sha256(), mackey, mackey_size, data.data(), datasize, hash, &digest_size) ||
+      std::memcmp(data.data() + datasize, hash, SHA256_DIGEST_LENGTH) != 0)
+  {
+    std::cout << "Bad MAC in frame index '" << filename << "' (corrupted, or not made for this backup)" << std::endl;
+    return false;
+  }
+  data.resize(datasize);
+
+  // check it belongs to this backup
+  uint64_t pos = STRLEN(FRAMEINDEX_MAGIC);
+  uint32_t version = 0;
+  uint64_t indexfilesize = 0;
+  uint64_t indexsalt_size = 0;
+  if (!extract(data, &pos, &version) || version != s_version ||
+      !extract(data, &pos, &indexfilesize) || indexfilesize != filesize ||
+      !extract(data, &pos, &indexsalt_size) || indexsalt_size != salt_size ||
+      pos + salt_size > data.size() || std::memcmp(data.data() + pos, salt, salt_size) != 0)
+  {
+    std::cout << "Frame index '" << filename << "' does not match backup file" << std::endl;
+    return false;
+  }
+  pos += salt_size;
+
+  uint64_t count = 0;
+  if (!extract(data, &pos, &count))
+    return false;
+
+  for (uint64_t i = 0; i < count; ++i)
+  {
+    Entry e;
+    uint32_t tablelength = 0;
+    if (!extract(data, &pos, &e.offset) ||
+        !extract(data, &pos, &e.counter) ||
+        !extract(data, &pos, &e.frametype) ||
+        !extract(data, &pos, &e.attachmentoffset) ||
+        !extract(data, &pos, &e.attachmentsize) ||
+        !extract(data, &pos, &e.rowid) ||
+        !extract(data, &pos, &e.uniqueid) ||
+        !extract(data, &pos, &tablelength) ||
+        pos + tablelength > data.size())
+    {
+      std::cout << "Unexpected end of data in frame index '" << filename << "'" << std::endl;
+      d_entries.clear();
+      return false;
+    }
+    e.table.assign(reinterpret_cast<char const *>(data.data() + pos), tablelength);
+    pos += tablelength;
+    d_entries.emplace_back(std::move(e));
+  }
+  return true;
+}
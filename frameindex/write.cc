@@ -0,0 +1,67 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "frameindex.ih"
+
+/*
+  layout:
+  magic, version, backup filesize, salt size, salt, number of entries,
+  entries (offset, counter, frametype, attachmentoffset, attachmentsize,
+  rowid, uniqueid, table length, table), HMAC-SHA256 of all preceding data
+*/
+bool FrameIndex::write(std::string const &filename, uint64_t filesize, unsigned char const *salt, uint64_t salt_size,
+                       unsigned char const *mackey, uint64_t mackey_size) const
+{
+  std::vector<unsigned char> data(FRAMEINDEX_MAGIC, FRAMEINDEX_MAGIC + STRLEN(FRAMEINDEX_MAGIC));
+  append(&data, s_version);
+  append(&data, filesize);
+  append(&data, salt_size);
+  data.insert(data.end(), salt, salt + salt_size);
+  append(&data, static_cast<uint64_t>(d_entries.size()));
+  for (auto const &e : d_entries)
+  {
+    append(&data, e.offset);
+    append(&data, e.counter);
+    append(&data, e.frametype);
+    append(&data, e.attachmentoffset);
+    append(&data, e.attachmentsize);
+    append(&data, e.rowid);
+    append(&data, e.uniqueid);
+    append(&data, static_cast<uint32_t>(e.table.size()));
+    data.insert(data.end(), e.table.begin(), e.table.end());
+  }
+
+  unsigned int digest_size = SHA256_DIGEST_LENGTH;
+  unsigned char hash[SHA256_DIGEST_LENGTH];
+  if (!HMAC(EVP_sha256(), mackey, mackey_size, data.data(), data.size(), hash, &digest_size))
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to calculate MAC for frame index" << std::endl;
+    return false;
+  }
+  data.insert(data.end(), hash, hash + SHA256_DIGEST_LENGTH);
+
+  std::ofstream file(filename, std::ios_base::binary | std::ios_base::trunc);
+  if (!file.is_open() ||
+      !file.write(reinterpret_cast<char *>(data.data()), data.size()))
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to write frame index to '" << filename << "'" << std::endl;
+    return false;
+  }
+  return true;
+}
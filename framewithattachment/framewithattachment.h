@@ -25,6 +25,7 @@
 #include <fstream>
 
 #include "../backupframe/backupframe.h"
+#include "../mappedfile/mappedfile.h"
 
 class FrameWithAttachment : public BackupFrame
 {
@@ -39,6 +40,7 @@ class FrameWithAttachment : public BackupFrame
   uint64_t d_cipherkey_size;
   unsigned char *d_cipherkey;
   std::string d_filename;
+  std::shared_ptr<MappedFile> d_mappedfile; // if set, encrypted data is read from here (at d_filepos)
 
   //BaseDecryptor *d_dec; // DONT OWN THIS!
  public:
@@ -61,10 +63,13 @@ class FrameWithAttachment : public BackupFrame
   inline unsigned char *cipherkey() const;
   inline uint64_t cipherkey_size() const;
   inline std::string const &filename() const;
+  inline MappedFile const *mappedFile() const;
+  inline void setMappedFile(std::shared_ptr<MappedFile> const &mappedfile);
   inline void setLazyData(unsigned char *iv, uint32_t iv_size, unsigned char *mackey, uint64_t mackey_size, unsigned char *cipherkey, uint64_t cipherkey_size, uint32_t attsize, std::string const &filename, uint64_t filepos);
   inline void setLazyDataRAW(uint32_t attsize, std::string const &filename);
   //inline virtual void setLazyData(unsigned char *iv, uint32_t iv_size, uint32_t attsize, uint64_t filepos, BaseDecryptor *dec);
   inline unsigned char *attachmentData(bool *badmac = nullptr);
+  inline bool attachmentDataLoaded() const;
   inline void clearData();
 };
 
@@ -110,7 +115,8 @@ inline FrameWithAttachment::FrameWithAttachment(FrameWithAttachment &&other)
   d_mackey(std::move(other.d_mackey)),
   d_cipherkey_size(std::move(other.d_cipherkey_size)),
   d_cipherkey(std::move(other.d_cipherkey)),
-  d_filename(std::move(other.d_filename))
+  d_filename(std::move(other.d_filename)),
+  d_mappedfile(std::move(other.d_mappedfile))
 //d_dec(std::move(other.d_dec))
 {
   other.d_attachmentdata = nullptr;
@@ -143,6 +149,7 @@ inline FrameWithAttachment &FrameWithAttachment::operator=(FrameWithAttachment &
     d_mackey = std::move(other.d_mackey);
     d_cipherkey_size = std::move(other.d_cipherkey_size);
     d_cipherkey = std::move(other.d_cipherkey);
+    d_mappedfile = std::move(other.d_mappedfile);
     //d_dec = std::move(other.d_dec);
 
     other.d_attachmentdata = nullptr;
@@ -169,7 +176,8 @@ inline FrameWithAttachment::FrameWithAttachment(FrameWithAttachment const &other
   d_mackey_size(other.d_mackey_size),
   d_mackey(nullptr),
   d_cipherkey_size(other.d_cipherkey_size),
-  d_cipherkey(nullptr)
+  d_cipherkey(nullptr),
+  d_mappedfile(other.d_mappedfile)
   //d_dec(other.d_dec)
 {
   if (other.d_attachmentdata)
@@ -212,6 +220,7 @@ inline FrameWithAttachment &FrameWithAttachment::operator=(FrameWithAttachment c
     d_mackey_size = other.d_mackey_size;
     d_cipherkey_size = other.d_cipherkey_size;
     d_filepos = other.d_filepos;
+    d_mappedfile = other.d_mappedfile;
     //d_dec = other.d_dec;
 
     if (other.d_attachmentdata)
@@ -294,6 +303,17 @@ inline std::string const &FrameWithAttachment::filename() const
   return d_filename;
 }
 
+inline MappedFile const *FrameWithAttachment::mappedFile() const
+{
+  return d_mappedfile.get();
+}
+
+// call after setLazyData(), which clears any previously set mapping
+inline void FrameWithAttachment::setMappedFile(std::shared_ptr<MappedFile> const &mappedfile)
+{
+  d_mappedfile = mappedfile;
+}
+
 inline void FrameWithAttachment::setLazyData(unsigned char *iv, uint32_t iv_size, unsigned char *mackey, uint64_t mackey_size, unsigned char *cipherkey, uint64_t cipherkey_size, uint32_t attsize, std::string const &filename, uint64_t filepos/*, BaseDecryptor *dec*/)
 {
   bepaald::destroyPtr(&d_attachmentdata, &d_attachmentdata_size);
@@ -326,6 +346,7 @@ inline void FrameWithAttachment::setLazyData(unsigned char *iv, uint32_t iv_size
 
   d_filename = filename;
   d_filepos = filepos;
+  d_mappedfile.reset();
 
   //d_dec = dec;
 }
@@ -357,6 +378,11 @@ inline unsigned char *FrameWithAttachment::attachmentData(bool *badmac)
   return d_attachmentdata;
 }
 
+inline bool FrameWithAttachment::attachmentDataLoaded() const
+{
+  return d_attachmentdata != nullptr;
+}
+
 inline void FrameWithAttachment::clearData()
 {
   if (d_attachmentdata) // do not use bepaald::destroyPtr, it will set size to zero
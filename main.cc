@@ -71,6 +71,31 @@ int main(int argc, char *argv[])
     return 0;
   }
 
+  // reuse backup keys derived in earlier runs
+  if (!arg.keycache().empty())
+    CryptBase::setKeyCacheFile(arg.keycache());
+
+  // keep the working database(s) on disk
+  if (!arg.workdbdir().empty())
+    SignalBackup::setWorkingDatabaseDir(arg.workdbdir());
+
+  if (arg.sqlprofile() > 0 || !arg.sqlprofilejson().empty())
+    SqliteDB::setProfiling(true);
+
+  // reports the sql profile on every return from here on. Declared before any database
+  // is opened, so it runs after they are all closed and all their statements have reported
+  struct ProfileReport
+  {
+    Arg const &d_arg;
+    ~ProfileReport()
+    {
+      if (d_arg.sqlprofile() > 0)
+        SqliteDB::printProfile(d_arg.sqlprofile());
+      if (!d_arg.sqlprofilejson().empty())
+        SqliteDB::writeProfileJson(d_arg.sqlprofilejson());
+    }
+  } profilereport{arg};
+
   bool ipw_interactive = false;
   if ((arg.passphrase().empty() || arg.interactive()) && // prompt for input passphrase
       !bepaald::isDir(arg.input()))
@@ -162,13 +187,43 @@ int main(int argc, char *argv[])
     return 0;
   }
 
+  // transcode: stream the frames straight from input to output, the database is never loaded
+  if (arg.transcode())
+  {
+    std::function<bool(BackupFrame const *)> keepframe;
+    if (arg.stripattachmentdata())
+      keepframe = [](BackupFrame const *frame)
+      {
+        return frame->frameType() != BackupFrame::FRAMETYPE::ATTACHMENT &&
+          frame->frameType() != BackupFrame::FRAMETYPE::AVATAR &&
+          frame->frameType() != BackupFrame::FRAMETYPE::STICKER;
+      };
+    if (!SignalBackup::transcodeBackup(arg.input(), arg.passphrase(), arg.output(), arg.opassphrase(), arg.overwrite(), keepframe,
+                                       arg.verbose(), arg.showprogress(), arg.threads() > 1 ? arg.threads() : 1, arg.mmap()))
+    {
+      std::cout << "Failed to transcode backup" << std::endl;
+      return 1;
+    }
+    return 0;
+  }
+
   MEMINFO("Start of program, before opening input");
 
+  // when only listing, just the needed tables are loaded. Any other operation
+  // will trigger loading the remaining data automatically
+  std::set<std::string> loadtables;
+  bool partialload = arg.listthreads() || arg.listrecipients() || arg.showdbinfo();
+  if (arg.listthreads())
+    loadtables.insert({"thread", "recipient", "recipient_preferences", "groups", "sms", "mms", "message"});
+  if (arg.listrecipients())
+    loadtables.insert({"recipient", "groups"});
+
   // open input
   std::unique_ptr<SignalBackup> sb(new SignalBackup(arg.input(), arg.passphrase(), arg.verbose(), arg.showprogress(),
                                                     arg.replaceattachments_bool(),
                                                     arg.assumebadframesizeonbadmac(), arg.editattachmentsize(),
-                                                    arg.stoponerror()));
+                                                    arg.stoponerror(), arg.threads() > 1 ? arg.threads() : 1, arg.mmap(), arg.frameindex(),
+                                                    partialload ? &loadtables : nullptr, arg.timings()));
   if (!sb->ok())
   {
     std::cout << "Failed to open backup" << std::endl;
@@ -356,8 +411,7 @@ int main(int argc, char *argv[])
       return 1;
 
   if (!arg.exportcsv().empty())
-    for (uint i = 0; i < arg.exportcsv().size(); ++i)
-      sb->exportCsv(arg.exportcsv()[i].second, arg.exportcsv()[i].first);
+    sb->exportCsv(arg.exportcsv());
 
   if (!arg.exportxml().empty())
     if (!sb->exportXml(arg.exportxml(), arg.overwrite(), arg.setselfid(), arg.includemms(), SignalBackup::DROPATTACHMENTDATA))
@@ -426,7 +480,8 @@ int main(int argc, char *argv[])
   if (!arg.output().empty())
   {
     sb->checkDbIntegrity(true);
-    if (!sb->exportBackup(arg.output(), arg.opassphrase(), arg.overwrite(), SignalBackup::DROPATTACHMENTDATA, arg.onlydb()))
+    if (!sb->exportBackup(arg.output(), arg.opassphrase(), arg.overwrite(), SignalBackup::DROPATTACHMENTDATA, arg.onlydb(),
+                          arg.maxoutstandingfiles() > 0 ? arg.maxoutstandingfiles() : 0))
     {
       std::cout << "Failed to export backup to '" << arg.output() << "'" << std::endl;
       return 1;
@@ -438,7 +493,8 @@ int main(int argc, char *argv[])
   // decode and dump Signal-Desktop database to 'desktop.db'.
   if (!arg.dumpdesktopdb_1().empty())
   {
-    SqlCipherDecryptor db(arg.dumpdesktopdb_1(), arg.dumpdesktopdb_2(), arg.desktopdbversion());
+    SqlCipherDecryptor db(arg.dumpdesktopdb_1(), arg.dumpdesktopdb_2(), arg.desktopdbversion(), false,
+                          arg.threads() > 1 ? arg.threads() : 1);
     if (!db.ok() || !db.writeToFile("desktop.db", arg.overwrite()))
       std::cout << "Failed to dump desktop database" << std::endl;
   }
@@ -451,6 +507,14 @@ int main(int argc, char *argv[])
 
   MEMINFO("At program end");
 
+  if (arg.timings())
+  {
+    long long int peak = bepaald::peakMemoryUsage();
+    if (peak >= 0)
+      std::cout << "Peak memory use: " << peak / (1024 * 1024) << "MB (working database "
+                << (arg.workdbdir().empty() ? "in memory" : "in '" + arg.workdbdir() + "'") << ")" << std::endl;
+  }
+
   return 0;
 }
 
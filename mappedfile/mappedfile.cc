@@ -0,0 +1,100 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "mappedfile.ih"
+
+#if !defined(_WIN32) && !defined(__MINGW64__)
+
+MappedFile::MappedFile(std::string const &filename)
+  :
+  d_data(nullptr),
+  d_size(0)
+{
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd == -1)
+  {
+    std::cout << bepaald::bold_on << "ERROR" << bepaald::bold_off << " Failed to open file '" << filename << "' for mapping" << std::endl;
+    return;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0)
+  {
+    close(fd);
+    return;
+  }
+
+  void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd); // the mapping stays valid after closing
+  if (data == MAP_FAILED)
+  {
+    std::cout << bepaald::bold_on << "ERROR" << bepaald::bold_off << " Failed to map file '" << filename << "' into memory" << std::endl;
+    return;
+  }
+
+  // the backup is read front to back: have the kernel read ahead
+  // aggressively and drop pages behind us
+  madvise(data, st.st_size, MADV_SEQUENTIAL);
+
+  d_data = static_cast<unsigned char *>(data);
+  d_size = st.st_size;
+}
+
+#else // this is poorly tested, I don't have windows
+
+MappedFile::MappedFile(std::string const &filename)
+  :
+  d_data(nullptr),
+  d_size(0)
+{
+  HANDLE hFile = CreateFile(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (hFile == INVALID_HANDLE_VALUE)
+  {
+    std::cout << bepaald::bold_on << "ERROR" << bepaald::bold_off << " Failed to open file '" << filename << "' for mapping" << std::endl;
+    return;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(hFile, &size) || size.QuadPart <= 0)
+  {
+    CloseHandle(hFile);
+    return;
+  }
+
+  HANDLE hMapping = CreateFileMapping(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+  CloseHandle(hFile);
+  if (!hMapping)
+  {
+    std::cout << bepaald::bold_on << "ERROR" << bepaald::bold_off << " Failed to map file '" << filename << "' into memory" << std::endl;
+    return;
+  }
+
+  void *data = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(hMapping); // the view keeps the mapping alive
+  if (!data)
+  {
+    std::cout << bepaald::bold_on << "ERROR" << bepaald::bold_off << " Failed to map file '" << filename << "' into memory" << std::endl;
+    return;
+  }
+
+  d_data = static_cast<unsigned char *>(data);
+  d_size = size.QuadPart;
+}
+
+#endif
@@ -0,0 +1,59 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef MAPPEDFILE_H_
+#define MAPPEDFILE_H_
+
+#include <string>
+#include <cstdint>
+
+// read-only mapping of an entire file into memory. When the file
+// could not be mapped, ok() returns false and the caller should fall
+// back to reading through a regular stream.
+class MappedFile
+{
+  unsigned char *d_data;
+  uint64_t d_size;
+
+ public:
+  explicit MappedFile(std::string const &filename);
+  MappedFile(MappedFile const &other) = delete;
+  MappedFile &operator=(MappedFile const &other) = delete;
+  ~MappedFile();
+  inline bool ok() const;
+  inline unsigned char const *data() const;
+  inline uint64_t size() const;
+};
+
+inline bool MappedFile::ok() const
+{
+  return d_data != nullptr;
+}
+
+inline unsigned char const *MappedFile::data() const
+{
+  return d_data;
+}
+
+inline uint64_t MappedFile::size() const
+{
+  return d_size;
+}
+
+#endif
@@ -0,0 +1,43 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+// adds value (row, column) of results as parameter to frame
+void SignalBackup::addStatementParameter(SqlStatementFrame *frame, SqliteDB::QueryResults const &results, size_t row, size_t column) // static
+{
+  switch (results.valueType(row, column))
+  {
+    case SqliteDB::QueryResults::ValueType::NULLVALUE:
+      frame->addNullParameter();
+      break;
+    case SqliteDB::QueryResults::ValueType::INTEGER:
+      frame->addIntParameter(results.getValueAs<long long int>(row, column));
+      break;
+    case SqliteDB::QueryResults::ValueType::TEXT:
+      frame->addStringParameter(results.textView(row, column));
+      break;
+    case SqliteDB::QueryResults::ValueType::BLOB:
+      frame->addBlobParameter(results.blobView(row, column));
+      break;
+    case SqliteDB::QueryResults::ValueType::FLOAT:
+      frame->addDoubleParameter(results.getValueAs<double>(row, column));
+      break;
+  }
+}
@@ -20,7 +20,7 @@
 #include "signalbackup.ih"
 
 SqlStatementFrame SignalBackup::buildSqlStatementFrame(std::string const &table, std::vector<std::string> const &headers,
-                                                       std::vector<std::any> const &result) const
+                                                       SqliteDB::QueryResults const &results, size_t row) const
 {
   //std::cout << "Building new frame:" << std::endl;
 
@@ -39,25 +39,14 @@ SqlStatementFrame SignalBackup::buildSqlStatementFrame(std::string const &table,
 
   newstatement += " VALUES (";
 
-  for (uint j = 0; j < result.size(); ++j)
+  for (uint j = 0; j < results.columns(); ++j)
   {
-    if (j < result.size() - 1)
+    if (j < results.columns() - 1)
       newstatement.append("?,");
     else
       newstatement.append("?)");
 
-    if (result[j].type() == typeid(nullptr))
-      newframe.addNullParameter();
-    else if (result[j].type() == typeid(long long int))
-      newframe.addIntParameter(std::any_cast<long long int>(result[j]));
-    else if (result[j].type() == typeid(std::string))
-      newframe.addStringParameter(std::any_cast<std::string>(result[j]));
-    else if (result[j].type() == typeid(std::pair<std::shared_ptr<unsigned char []>, size_t>))
-      newframe.addBlobParameter(std::any_cast<std::pair<std::shared_ptr<unsigned char []>, size_t>>(result[j]));
-    else if (result[j].type() == typeid(double))
-      newframe.addDoubleParameter(std::any_cast<double>(result[j]));
-    else
-      std::cout << "WARNING : UNHANDLED PARAMETER TYPE = " << result[j].type().name() << std::endl;
+    addStatementParameter(&newframe, results, row, j);
   }
 
   newframe.setStatementField(newstatement);
@@ -67,30 +56,19 @@ SqlStatementFrame SignalBackup::buildSqlStatementFrame(std::string const &table,
   return newframe;
 }
 
-SqlStatementFrame SignalBackup::buildSqlStatementFrame(std::string const &table, std::vector<std::any> const &result) const
+SqlStatementFrame SignalBackup::buildSqlStatementFrame(std::string const &table, SqliteDB::QueryResults const &results, size_t row) const
 {
   //std::cout << "Building new frame:" << std::endl;
 
   SqlStatementFrame newframe;
   std::string newstatement = "INSERT INTO " + table + " VALUES (";
-  for (uint j = 0; j < result.size(); ++j)
+  for (uint j = 0; j < results.columns(); ++j)
   {
-    if (j < result.size() - 1)
+    if (j < results.columns() - 1)
       newstatement.append("?,");
     else
       newstatement.append("?)");
-    if (result[j].type() == typeid(nullptr))
-      newframe.addNullParameter();
-    else if (result[j].type() == typeid(long long int))
-      newframe.addIntParameter(std::any_cast<long long int>(result[j]));
-    else if (result[j].type() == typeid(std::string))
-      newframe.addStringParameter(std::any_cast<std::string>(result[j]));
-    else if (result[j].type() == typeid(std::pair<std::shared_ptr<unsigned char []>, size_t>))
-      newframe.addBlobParameter(std::any_cast<std::pair<std::shared_ptr<unsigned char []>, size_t>>(result[j]));
-    else if (result[j].type() == typeid(double))
-      newframe.addDoubleParameter(std::any_cast<double>(result[j]));
-    else
-      std::cout << "WARNING : UNHANDLED PARAMETER TYPE = " << result[j].type().name() << std::endl;
+    addStatementParameter(&newframe, results, row, j);
   }
   newframe.setStatementField(newstatement);
 
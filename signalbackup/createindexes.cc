@@ -0,0 +1,38 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+// creates indexes whose creation was postponed until their table was filled (see
+// initFromFile()). Indexes on the same table are created together, so the table
+// data is still in cache for the next one
+bool SignalBackup::createIndexes(std::vector<std::pair<std::string, std::string>> *indexes)
+{
+  std::stable_sort(indexes->begin(), indexes->end(),
+                   [](auto const &a, auto const &b) { return a.first < b.first; });
+
+  bool ret = true;
+  for (auto const &[table, statement] : *indexes)
+    if (!d_database.exec(statement))
+    {
+      std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Failed to execute statement: " << statement << std::endl;
+      ret = false;
+    }
+  return ret;
+}
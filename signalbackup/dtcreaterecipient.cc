@@ -86,7 +86,7 @@ long long int SignalBackup::dtCreateRecipient(SqliteDB const &ddb,
       ddb.printLineMode("SELECT * FROM conversations WHERE " + d_dt_c_uuid + " = ? OR e164 = ? OR groupId = ?", {id, phone, groupidb64});
     }
 
-    d_database.exec("BEGIN TRANSACTION"); // things could still go bad...
+    d_database.beginSavepoint("createrecipient"); // things could still go bad... (a savepoint also works inside a transaction)
 
     std::any new_rid;
     if (!insertRow("recipient",
@@ -115,7 +115,7 @@ long long int SignalBackup::dtCreateRecipient(SqliteDB const &ddb,
                     {"revision", 0}}))
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to insert new group into database." << std::endl;
-      d_database.exec("ROLLBACK TRANSACTION");
+      d_database.rollbackSavepoint("createrecipient");
       bepaald::destroyPtr(&masterkey.first, &masterkey.second);
       return -1;
     }
@@ -139,7 +139,7 @@ long long int SignalBackup::dtCreateRecipient(SqliteDB const &ddb,
         if (member_rid == -1)
         {
           std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to get new groups members uuid." << std::endl;
-          d_database.exec("ROLLBACK TRANSACTION");
+          d_database.rollbackSavepoint("createrecipient");
           return -1;
         }
       }
@@ -151,7 +151,7 @@ long long int SignalBackup::dtCreateRecipient(SqliteDB const &ddb,
                         {"recipient_id", member_rid}}))
         {
           std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to set new groups membership." << std::endl;
-          d_database.exec("ROLLBACK TRANSACTION");
+          d_database.rollbackSavepoint("createrecipient");
           return -1;
         }
       }
@@ -165,7 +165,7 @@ long long int SignalBackup::dtCreateRecipient(SqliteDB const &ddb,
       if (!d_database.exec("UPDATE groups SET members = ? WHERE _id = ?", {oldstyle_members, new_rec_id}))
       {
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to set new groups membership (old style)." << std::endl;
-        d_database.exec("ROLLBACK TRANSACTION");
+        d_database.rollbackSavepoint("createrecipient");
         return -1;
       }
     }
@@ -259,7 +259,7 @@ long long int SignalBackup::dtCreateRecipient(SqliteDB const &ddb,
       d_database.exec("UPDATE groups SET decrypted_group = ? WHERE recipient_id = ?", {groupdetails, new_rid});
     }
 
-    d_database.exec("COMMIT TRANSACTION");
+    d_database.releaseSavepoint("createrecipient");
     (*recipient_info)[groupidb64] = new_rec_id;
 
     // set avatar
@@ -27,6 +27,11 @@ void SignalBackup::duplicateQuotes(std::string *s) const
 }
 
 void SignalBackup::exportCsv(std::string const &filename, std::string const &table) const
+{
+  exportCsv(d_database, filename, table);
+}
+
+void SignalBackup::exportCsv(SqliteDB const &database, std::string const &filename, std::string const &table) const
 {
   /*
   if (checkFileExists(filename))
@@ -39,21 +44,24 @@ void SignalBackup::exportCsv(std::string const &filename, std::string const &tab
   // output header
   std::ofstream outputfile(filename, std::ios_base::binary);
 
-  SqliteDB::QueryResults results;
-  d_database.exec("SELECT * FROM " + table, &results);
+  SqliteDB::Cursor cursor(database.query("SELECT * FROM " + table));
+  for (bool first = true; cursor.step(); first = false)
+  {
+    SqliteDB::QueryResults const &row = cursor.row();
 
-  // output header
-  for (uint i = 0; i < results.columns(); ++i)
-    outputfile << results.header(i) << ((i == results.columns() - 1) ? '\n' : ',');
+    // output header
+    if (first)
+      for (uint i = 0; i < row.columns(); ++i)
+        outputfile << row.header(i) << ((i == row.columns() - 1) ? '\n' : ',');
 
-  // output data
-  for (uint j = 0; j < results.rows(); ++j)
-    for (uint i = 0; i < results.columns(); ++i)
+    // output data
+    for (uint i = 0; i < row.columns(); ++i)
     {
-      std::string vas = results.valueAsString(j, i);
+      std::string vas = row.valueAsString(0, i);
       duplicateQuotes(&vas);
       bool escape = (vas.find_first_of(",\"\n") != std::string::npos) || // contains newline, quote or comma
         (!vas.empty() && (std::find_if(vas.begin(), vas.end(), [](char c){ return !std::isspace(c); }) == vas.end())); // is all whitespace (and non empty)
-      outputfile << (escape ? "\"" : "") << vas << (escape ? "\"" : "") << ((i == results.columns() - 1) ? '\n' : ',');
+      outputfile << (escape ? "\"" : "") << vas << (escape ? "\"" : "") << ((i == row.columns() - 1) ? '\n' : ',');
     }
+  }
 }
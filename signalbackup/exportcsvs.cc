@@ -0,0 +1,56 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+#include <atomic>
+#include <thread>
+
+// exports several tables ({table, filename} pairs) to csv. With more than one thread,
+// the tables are read in parallel, each worker through its own read-only connection on
+// one snapshot of the database. A file-backed working database can not be snapshotted
+// (see SqliteDB::snapshot()), its tables are exported one after the other.
+void SignalBackup::exportCsv(std::vector<std::pair<std::string, std::string>> const &tablesandfiles) const
+{
+  unsigned int numworkers = std::min(static_cast<uint64_t>(d_numthreads), static_cast<uint64_t>(tablesandfiles.size()));
+  SqliteDB::Snapshot snapshot(numworkers > 1 ? d_database.snapshot() : SqliteDB::Snapshot());
+  if (!snapshot.ok())
+  {
+    for (auto const &[table, filename] : tablesandfiles)
+      exportCsv(filename, table);
+    return;
+  }
+
+  std::atomic<uint64_t> next(0);
+  auto worker = [&]()
+  {
+    SqliteDB reader(snapshot);
+    uint64_t idx;
+    while ((idx = next.fetch_add(1, std::memory_order_relaxed)) < tablesandfiles.size())
+      exportCsv(reader, tablesandfiles[idx].second, tablesandfiles[idx].first);
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(numworkers - 1);
+  for (unsigned int i = 0; i < numworkers - 1; ++i)
+    workers.emplace_back(worker);
+  worker(); // this thread is one of the workers
+  for (auto &w : workers)
+    w.join();
+}
@@ -33,18 +33,17 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
                               bool overwrite, bool append, bool lighttheme, bool themeswitching) const
 {
   bool databasemigrated = false;
-  SqliteDB backup_database(":memory:");
 
   // >= 168 will work already? (not sure if 168 and 169 were ever in production, I don't have them at least)
   if (d_databaseversion == 167)
   {
-    SqliteDB::copyDb(d_database, backup_database);
+    d_database.beginSavepoint("exportmigration");
     if (!migrateDatabase(167, 170))
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                 << ": Failed to migrate currently unsupported database version (" << d_databaseversion << ")."
                 << " Please upgrade your database" << std::endl;
-      SqliteDB::copyDb(backup_database, d_database);
+      d_database.rollbackSavepoint("exportmigration");
       return false;
     }
     else
@@ -61,13 +60,13 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
                 << "       migrate this database to a supported version." << std::endl;
       return false;
     }
-    SqliteDB::copyDb(d_database, backup_database);
+    d_database.beginSavepoint("exportmigration");
     if (!migrateDatabase(d_databaseversion, 170)) // migrate == TRUE, but migration fails
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                 << ": Failed to migrate currently unsupported database version (" << d_databaseversion << ")."
                 << " Please upgrade your database" << std::endl;
-      SqliteDB::copyDb(backup_database, d_database);
+      d_database.rollbackSavepoint("exportmigration");
       return false;
     }
     else
@@ -94,7 +93,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
         }
       }
       if (databasemigrated)
-        SqliteDB::copyDb(backup_database, d_database);
+        d_database.rollbackSavepoint("exportmigration");
       return false;
     }
   }
@@ -106,7 +105,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
     std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
               << ": `" << directory << "' is not a directory." << std::endl;
     if (databasemigrated)
-      SqliteDB::copyDb(backup_database, d_database);
+      d_database.rollbackSavepoint("exportmigration");
     return false;
   }
 
@@ -119,7 +118,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
                 << ": Directory '" << directory << "' is not empty. Use --overwrite to clear directory before export, " << std::endl
                 << "       or --append to only write new files." << std::endl;
       if (databasemigrated)
-        SqliteDB::copyDb(backup_database, d_database);
+        d_database.rollbackSavepoint("exportmigration");
       return false;
     }
     std::cout << "Clearing contents of directory '" << directory << "'..." << std::endl;
@@ -128,7 +127,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                 << ": Failed to empty directory '" << directory << "'" << std::endl;
       if (databasemigrated)
-        SqliteDB::copyDb(backup_database, d_database);
+        d_database.rollbackSavepoint("exportmigration");
       return false;
     }
   }
@@ -288,7 +287,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                   << ": dir is regular file" << std::endl;
         if (databasemigrated)
-          SqliteDB::copyDb(backup_database, d_database);
+          d_database.rollbackSavepoint("exportmigration");
         return false;
       }
       if (!append && !overwrite) // should be impossible at this point....
@@ -296,7 +295,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                   << ": Refusing to overwrite existing directory" << std::endl;
         if (databasemigrated)
-          SqliteDB::copyDb(backup_database, d_database);
+          d_database.rollbackSavepoint("exportmigration");
         return false;
       }
     }
@@ -316,7 +315,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
         }
       }
       if (databasemigrated)
-        SqliteDB::copyDb(backup_database, d_database);
+        d_database.rollbackSavepoint("exportmigration");
       return false;
     }
 
@@ -351,7 +350,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
         std::cout << bepaald::bold_on << "ERROR" << bepaald::bold_off
                   << ": Failed to open '" << directory << "/" << threaddir << "/" << filename << " for writing." << std::endl;
         if (databasemigrated)
-          SqliteDB::copyDb(backup_database, d_database);
+          d_database.rollbackSavepoint("exportmigration");
         return false;
       }
 
@@ -743,7 +742,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
   if (databasemigrated)
   {
     std::cout << "restoring migrated database..." << std::endl;
-    SqliteDB::copyDb(backup_database, d_database);
+    d_database.rollbackSavepoint("exportmigration");
   }
   return true;
 }
@@ -19,7 +19,8 @@
 
 #include "signalbackup.ih"
 
-bool SignalBackup::exportBackupToDir(std::string const &directory, bool overwrite, bool keepattachmentdatainmemory, bool onlydb)
+bool SignalBackup::exportBackupToDir(std::string const &directory, bool overwrite, bool keepattachmentdatainmemory, bool onlydb,
+                                     unsigned int maxoutstandingfiles)
 {
   std::cout << std::endl << "Exporting backup into '" << directory << "/'" << std::endl;
 
@@ -51,73 +52,12 @@ bool SignalBackup::exportBackupToDir(std::string const &directory, bool overwrit
     if (!writeRawFrameDataToFile(directory + "/DatabaseVersion.sbf", d_databaseversionframe))
       return false;
 
-    // export attachments
-    std::cout << "Writing Attachments..." << std::endl;
-    for (auto const &aframe : d_attachments)
-    {
-      AttachmentFrame *a = aframe.second.get();
-      std::string attachment_basefilename = directory + "/Attachment_" + bepaald::toString(a->rowId()) + "_" + bepaald::toString(a->attachmentId());
-
-      // write frame
-      if (!writeRawFrameDataToFile(attachment_basefilename + ".sbf", a))
-        return false;
-
-      // write actual attachment:
-      std::ofstream attachmentstream(attachment_basefilename + ".bin", std::ios_base::binary);
-      if (!attachmentstream.is_open())
-      {
-        std::cout << "Failed to open file for writing: " << directory << attachment_basefilename << ".bin" << std::endl;
-        return false;
-      }
-      else
-        if (!attachmentstream.write(reinterpret_cast<char *>(a->attachmentData()), a->attachmentSize()))
-          return false;
-
-      if (!keepattachmentdatainmemory)
-      {
-        MEMINFO("BEFORE DROPPING ATTACHMENT DATA");
-        a->clearData();
-        MEMINFO("AFTER DROPPING ATTACHMENT DATA");
-      }
-    }
-
-    // export avatars
-    std::cout << "Writing Avatars..." << std::endl;
-#if __cplusplus > 201703L
-    for (int count = 1; auto const &aframe : d_avatars)
-#else
-      int count = 1;
-    for (auto const &aframe : d_avatars)
-#endif
-    {
-      AvatarFrame *a = aframe.second.get();
-      std::string avatar_basefilename = directory + "/Avatar_" +
-        std::string(bepaald::numDigits(d_avatars.size()) - bepaald::numDigits(count), '0') + bepaald::toString(count)
-        + "_" + ((d_databaseversion < 33) ? a->name() : a->recipient());
-      ++count;
-
-      // write frame
-      if (!writeRawFrameDataToFile(avatar_basefilename + ".sbf", a))
-        return false;
-
-      // write actual avatar:
-      std::ofstream avatarstream(avatar_basefilename + ".bin", std::ios_base::binary);
-      if (!avatarstream.is_open())
-      {
-        std::cout << "Failed to open file for writing: " << directory << avatar_basefilename << ".bin" << std::endl;
-        return false;
-      }
-      else
-        if (!avatarstream.write(reinterpret_cast<char *>(a->attachmentData()), a->attachmentSize()))
-          return false;
-    }
-
     // export sharedpreferences
     std::cout << "Writing SharedPrefFrame(s)..." << std::endl;
 #if __cplusplus > 201703L
     for (int count = 1; auto const &spframe : d_sharedpreferenceframes)
 #else
-      count = 1;
+    int count = 1;
     for (auto const &spframe : d_sharedpreferenceframes)
 #endif
       if (!writeRawFrameDataToFile(directory + "/SharedPreference_" + bepaald::toString(count++) + ".sbf", spframe))
@@ -128,40 +68,52 @@ bool SignalBackup::exportBackupToDir(std::string const &directory, bool overwrit
 #if __cplusplus > 201703L
     for (int count = 1; auto const &kvframe : d_keyvalueframes)
 #else
-      count = 1;
+    count = 1;
     for (auto const &kvframe : d_keyvalueframes)
 #endif
       if (!writeRawFrameDataToFile(directory + "/KeyValue_" + bepaald::toString(count++) + ".sbf", kvframe))
         return false;
 
-    // export stickers
-    std::cout << "Writing StickerFrames..." << std::endl;
+    // export attachments, avatars and stickers (decrypted and written concurrently)
+    std::vector<AttachmentFile> files;
+    files.reserve(d_attachments.size() + d_avatars.size() + d_stickers.size());
+
+    for (auto const &aframe : d_attachments)
+    {
+      AttachmentFrame *a = aframe.second.get();
+      files.emplace_back(AttachmentFile{a, directory + "/Attachment_" + bepaald::toString(a->rowId()) + "_" + bepaald::toString(a->attachmentId()),
+                                        !keepattachmentdatainmemory});
+    }
+
+#if __cplusplus > 201703L
+    for (int count = 1; auto const &aframe : d_avatars)
+#else
+    count = 1;
+    for (auto const &aframe : d_avatars)
+#endif
+    {
+      AvatarFrame *a = aframe.second.get();
+      files.emplace_back(AttachmentFile{a, directory + "/Avatar_" +
+                                        std::string(bepaald::numDigits(d_avatars.size()) - bepaald::numDigits(count), '0') + bepaald::toString(count)
+                                        + "_" + ((d_databaseversion < 33) ? a->name() : a->recipient()), false});
+      ++count;
+    }
+
 #if __cplusplus > 201703L
     for (int count = 1; auto const &sframe : d_stickers)
 #else
-      count = 1;
+    count = 1;
     for (auto const &sframe : d_stickers)
 #endif
     {
       StickerFrame *s = sframe.second.get();
-      std::string sticker_basefilename = directory + "/Sticker_" + bepaald::toString(count++) + "_" + bepaald::toString(s->rowId());
-
-      // write frame
-      if (!writeRawFrameDataToFile(sticker_basefilename + ".sbf", s))
-        return false;
-
-      // write actual sticker data
-      std::ofstream stickerstream(sticker_basefilename + ".bin", std::ios_base::binary);
-      if (!stickerstream.is_open())
-      {
-        std::cout << "Failed to open file for writing: " << directory << sticker_basefilename << ".bin" << std::endl;
-        return false;
-      }
-      else
-        if (!stickerstream.write(reinterpret_cast<char *>(s->attachmentData()), s->attachmentSize()))
-          return false;
+      files.emplace_back(AttachmentFile{s, directory + "/Sticker_" + bepaald::toString(count++) + "_" + bepaald::toString(s->rowId()), false});
     }
 
+    std::cout << "Writing Attachments, Avatars and Stickers..." << std::endl;
+    if (!writeAttachmentFiles(files, maxoutstandingfiles ? maxoutstandingfiles : d_numthreads))
+      return false;
+
     // export endframe
     std::cout << "Writing EndFrame..." << std::endl;
     if (!writeRawFrameDataToFile(directory + "/End.sbf", d_endframe))
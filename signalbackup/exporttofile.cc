@@ -64,6 +64,20 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
   if (!writeok)
     return false;
 
+  // all other frames are encrypted by d_fe, which writes them to outputfile, on d_numthreads
+  // threads if more than one (the guard stops the workers and detaches the file on return)
+  d_fe.setOutputFile(&outputfile);
+  d_fe.startPipeline(d_numthreads);
+  struct OutputGuard
+  {
+    FileEncryptor *fe;
+    ~OutputGuard()
+    {
+      fe->stopPipeline();
+      fe->setOutputFile(nullptr);
+    }
+  } outputguard{&d_fe};
+
   // VERSION
   std::cout << "Writing DatabaseVersionFrame..." << std::endl;
   if (!d_databaseversionframe)
@@ -71,7 +85,7 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
     std::cout << "Error: DataBaseVersionFrame not found" << std::endl;
     return false;
   }
-  if (!writeEncryptedFrame(outputfile, d_databaseversionframe.get()))
+  if (!writeEncryptedFrame(d_databaseversionframe.get()))
     return false;
 
   // SQL DATABASE + ATTACHMENTS
@@ -83,7 +97,7 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
   d_database.exec(q, &results);
   std::vector<std::string> tables;
 
-  for (uint i = 0; i < results.rows(); ++i)
+  for (uint i : schemaRowOrder(results))
   {
     if (!results.isNull(i, 0))
     {
@@ -121,7 +135,7 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
       newframe.setStatementField(results.getValueAs<std::string>(i, 0));
 
       //std::cout << "Writing SqlStatementFrame..." << std::endl;
-      if (!writeEncryptedFrame(outputfile, &newframe))
+      if (!writeEncryptedFrame(&newframe))
         return false;
     }
   }
@@ -146,37 +160,41 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
         STRING_STARTS_WITH(table, "sqlite_"))
       continue;
 
-    d_database.exec("SELECT * FROM " + table, &results);
+    // rows are written as they are read, the table is never loaded into memory completely
+    long long int rowcount = d_showprogress ? d_database.getSingleResultAs<long long int>("SELECT COUNT(*) FROM " + table, 0) : 0;
+    SqliteDB::Cursor cursor(d_database.query("SELECT * FROM " + table));
 
     if (!d_showprogress)
       std::cout << "  Dealing with table '" << table << "'... " << std::flush;
 
-    for (uint i = 0; i < results.rows(); ++i)
+    uint i = 0;
+    for (; cursor.step(); ++i)
     {
+      SqliteDB::QueryResults const &row = cursor.row();
       if (d_showprogress)
-        std::cout << "\33[2K\r  Dealing with table '" << table << "'... " << i + 1 << "/" << results.rows() << " entries..." << std::flush;
+        std::cout << "\33[2K\r  Dealing with table '" << table << "'... " << i + 1 << "/" << rowcount << " entries..." << std::flush;
 
-      SqlStatementFrame newframe = buildSqlStatementFrame(table, results.row(i));
+      SqlStatementFrame newframe = buildSqlStatementFrame(table, row, 0);
 
       //std::cout << "Writing SqlStatementFrame..." << std::endl;
-      if (!writeEncryptedFrame(outputfile, &newframe))
+      if (!writeEncryptedFrame(&newframe))
         return false;
 
       if (table == "part") // find corresponding attachment
       {
         uint64_t rowid = 0, uniqueid = 0;
-        for (uint j = 0; j < results.columns(); ++j)
+        for (uint j = 0; j < row.columns(); ++j)
         {
-          if (results.header(j) == "_id" && results.valueHasType<long long int>(i, j))
+          if (row.header(j) == "_id" && row.valueHasType<long long int>(0, j))
           {
-            rowid = results.getValueAs<long long int>(i, j);
+            rowid = row.getValueAs<long long int>(0, j);
             if (rowid && uniqueid)
               break;
           }
-          else if (results.header(j) == "unique_id" && results.valueHasType<long long int>(i, j))
+          else if (row.header(j) == "unique_id" && row.valueHasType<long long int>(0, j))
           {
            //std::cout << "UNIQUEID: " << std::any_cast<long long int>(results[i][j].second) << std::endl;
-            uniqueid = results.getValueAs<long long int>(i, j);
+            uniqueid = row.getValueAs<long long int>(0, j);
             if (rowid && uniqueid)
               break;
           }
@@ -184,14 +202,8 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
         auto attachment = d_attachments.find({rowid, uniqueid});
         if (attachment != d_attachments.end())
         {
-          if (!writeEncryptedFrame(outputfile, attachment->second.get()))
+          if (!writeEncryptedFrame(attachment->second.get(), !keepattachmentdatainmemory))
             return false;
-          if (!keepattachmentdatainmemory)
-          {
-            MEMINFO("BEFORE DROPPING ATTACHMENT DATA");
-            attachment->second.get()->clearData();
-            MEMINFO("AFTER DROPPING ATTACHMENT DATA");
-          }
         }
         else
         {
@@ -199,36 +211,36 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
           {
             std::cout << "Warning: attachment data not found (rowid: " << rowid << ", uniqueid: " << uniqueid << ")" << std::endl;
             if (d_showprogress)
-              std::cout << "\33[2K\r  Dealing with table '" << table << "'... " << i + 1 << "/" << results.rows() << " entries..." << std::flush;
+              std::cout << "\33[2K\r  Dealing with table '" << table << "'... " << i + 1 << "/" << rowcount << " entries..." << std::flush;
           }
         }
       }
       else if (table == "sticker") // find corresponding sticker
       {
         uint64_t rowid = 0;
-        for (uint j = 0; j < results.columns(); ++j)
-          if (results.header(j) == "_id" && results.valueHasType<long long int>(i, j))
+        for (uint j = 0; j < row.columns(); ++j)
+          if (row.header(j) == "_id" && row.valueHasType<long long int>(0, j))
           {
-            rowid = results.getValueAs<long long int>(i, j);
+            rowid = row.getValueAs<long long int>(0, j);
             break;
           }
         auto sticker = d_stickers.find(rowid);
         if (sticker != d_stickers.end())
         {
-          if (!writeEncryptedFrame(outputfile, sticker->second.get()))
+          if (!writeEncryptedFrame(sticker->second.get(), !keepattachmentdatainmemory))
             return false;
-          if (!keepattachmentdatainmemory)
-            sticker->second.get()->clearData();
         }
         else
         {
           std::cout << "Warning: sticker data not found (rowid: " << rowid << ")" << std::endl;
           if (d_showprogress)
-            std::cout << "\33[2K\r  Dealing with table '" << table << "'... " << i + 1 << "/" << results.rows() << " entries..." << std::flush;
+            std::cout << "\33[2K\r  Dealing with table '" << table << "'... " << i + 1 << "/" << rowcount << " entries..." << std::flush;
         }
       }
     }
-    if (results.rows())
+    if (!cursor.ok())
+      return false;
+    if (i)
         std::cout << "done" << std::endl;
     else
       std::cout << "  Dealing with table '" << table << "'... 0/0 entries..." << std::endl;
@@ -237,19 +249,19 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
   std::cout << "Writing SharedPrefFrame(s)..." << std::endl;
   // SHAREDPREFS
   for (uint i = 0; i < d_sharedpreferenceframes.size(); ++i)
-    if (!writeEncryptedFrame(outputfile, d_sharedpreferenceframes[i].get()))
+    if (!writeEncryptedFrame(d_sharedpreferenceframes[i].get()))
       return false;
 
   std::cout << "Writing KeyValueFrame(s)..." << std::endl;
   // KEYVALUES
   for (uint i = 0; i < d_keyvalueframes.size(); ++i)
-    if (!writeEncryptedFrame(outputfile, d_keyvalueframes[i].get()))
+    if (!writeEncryptedFrame(d_keyvalueframes[i].get()))
       return false;
 
   // AVATAR
   std::cout << "Writing Avatars..." << std::endl;
   for (auto const &a : d_avatars)
-    if (!writeEncryptedFrame(outputfile, a.second.get()))
+    if (!writeEncryptedFrame(a.second.get()))
       return false;
 
   // END
@@ -259,7 +271,9 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
     std::cout << "Error: EndFrame not found" << std::endl;
     return false;
   }
-  if (!writeEncryptedFrame(outputfile, d_endframe.get()))
+  if (!writeEncryptedFrame(d_endframe.get()) ||
+      !d_fe.finishPipeline() ||
+      !d_fe.flushStaging())
     return false;
 
   outputfile.flush();
@@ -25,18 +25,17 @@ bool SignalBackup::exportTxt(std::string const &directory, std::vector<long long
                              bool migrate, bool overwrite) const
 {
   bool databasemigrated = false;
-  SqliteDB backup_database(":memory:");
 
   // >= 168 will work already? (not sure if 168 and 169 were ever in production, I don't have them at least)
   if (d_databaseversion == 167)
   {
-    SqliteDB::copyDb(d_database, backup_database);
+    d_database.beginSavepoint("exportmigration");
     if (!migrateDatabase(167, 170))
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                 << ": Failed to migrate currently unsupported database version (" << d_databaseversion << ")."
                 << " Please upgrade your database" << std::endl;
-      SqliteDB::copyDb(backup_database, d_database);
+      d_database.rollbackSavepoint("exportmigration");
       return false;
     }
     else
@@ -53,13 +52,13 @@ bool SignalBackup::exportTxt(std::string const &directory, std::vector<long long
                 << "       migrate this database to a supported version." << std::endl;
       return false;
     }
-    SqliteDB::copyDb(d_database, backup_database);
+    d_database.beginSavepoint("exportmigration");
     if (!migrateDatabase(d_databaseversion, 170)) // migrate == TRUE, but migration fails
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                 << ": Failed to migrate currently unsupported database version (" << d_databaseversion << ")."
                 << " Please upgrade your database" << std::endl;
-      SqliteDB::copyDb(backup_database, d_database);
+      d_database.rollbackSavepoint("exportmigration");
       return false;
     }
     else
@@ -86,7 +85,7 @@ bool SignalBackup::exportTxt(std::string const &directory, std::vector<long long
         }
       }
       if (databasemigrated)
-        SqliteDB::copyDb(backup_database, d_database);
+        d_database.rollbackSavepoint("exportmigration");
       return false;
     }
   }
@@ -98,7 +97,7 @@ bool SignalBackup::exportTxt(std::string const &directory, std::vector<long long
     std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
               << ": `" << directory << "' is not a directory." << std::endl;
     if (databasemigrated)
-      SqliteDB::copyDb(backup_database, d_database);
+      d_database.rollbackSavepoint("exportmigration");
     return false;
   }
 
@@ -110,7 +109,7 @@ bool SignalBackup::exportTxt(std::string const &directory, std::vector<long long
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                 << ": Directory '" << directory << "' is not empty. Use --overwrite to clear directory before export." << std::endl;
       if (databasemigrated)
-        SqliteDB::copyDb(backup_database, d_database);
+        d_database.rollbackSavepoint("exportmigration");
       return false;
     }
     std::cout << "Clearing contents of directory '" << directory << "'..." << std::endl;
@@ -119,7 +118,7 @@ bool SignalBackup::exportTxt(std::string const &directory, std::vector<long long
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                 << ": Failed to empty directory '" << directory << "'" << std::endl;
       if (databasemigrated)
-        SqliteDB::copyDb(backup_database, d_database);
+        d_database.rollbackSavepoint("exportmigration");
       return false;
     }
   }
@@ -228,7 +227,7 @@ bool SignalBackup::exportTxt(std::string const &directory, std::vector<long long
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                 << ": Failed to query database for messages" << std::endl;
       if (databasemigrated)
-        SqliteDB::copyDb(backup_database, d_database);
+        d_database.rollbackSavepoint("exportmigration");
       return false;
     }
     if (messages.rows() == 0)
@@ -256,7 +255,7 @@ bool SignalBackup::exportTxt(std::string const &directory, std::vector<long long
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                 << ": Refusing to overwrite existing file" << std::endl;
       if (databasemigrated)
-        SqliteDB::copyDb(backup_database, d_database);
+        d_database.rollbackSavepoint("exportmigration");
       return false;
     }
 
@@ -266,7 +265,7 @@ bool SignalBackup::exportTxt(std::string const &directory, std::vector<long long
       std::cout << bepaald::bold_on << "ERROR" << bepaald::bold_off
                 << ": Failed to open '" << directory << "/" << filename << " for writing." << std::endl;
       if (databasemigrated)
-        SqliteDB::copyDb(backup_database, d_database);
+        d_database.rollbackSavepoint("exportmigration");
       return false;
     }
 
@@ -359,7 +358,7 @@ bool SignalBackup::exportTxt(std::string const &directory, std::vector<long long
   if (databasemigrated)
   {
     std::cout << "restoring migrated database..." << std::endl;
-    SqliteDB::copyDb(backup_database, d_database);
+    d_database.rollbackSavepoint("exportmigration");
   }
   return true;
 }
@@ -0,0 +1,59 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+// get the next frame listed in the index. Attachment frames are rebuilt from
+// the index without touching the backup file (their data is still read lazily),
+// all other frames are read directly from their recorded position. INSERTs into
+// tables not in loadtables (if set) are not read at all, only deferred.
+std::unique_ptr<BackupFrame> SignalBackup::getFrameFromIndex(FrameIndex const &index, uint64_t *pos, std::set<std::string> const *loadtables)
+{
+  if (loadtables)
+    while (*pos < index.entries().size() &&
+           !index.entries()[*pos].table.empty() &&
+           loadtables->find(index.entries()[*pos].table) == loadtables->end())
+    {
+      d_deferredframes.emplace_back(index.entries()[*pos].offset, index.entries()[*pos].counter, *pos);
+      ++(*pos);
+    }
+
+  if (*pos >= index.entries().size())
+    return std::unique_ptr<BackupFrame>(nullptr);
+
+  uint64_t framenumber = (*pos)++;
+  FrameIndex::Entry const &entry = index.entries()[framenumber];
+
+  if (entry.frametype == static_cast<uint32_t>(BackupFrame::FRAMETYPE::ATTACHMENT))
+  {
+    std::unique_ptr<AttachmentFrame> frame(new AttachmentFrame(framenumber));
+    if (!setFrameFromLine(&frame, "ROWID:uint64:" + bepaald::toString(entry.rowid)) ||
+        !setFrameFromLine(&frame, "ATTACHMENTID:uint64:" + bepaald::toString(entry.uniqueid)) ||
+        !setFrameFromLine(&frame, "LENGTH:uint32:" + bepaald::toString(entry.attachmentsize)))
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to create AttachmentFrame from index" << std::endl;
+      return std::unique_ptr<BackupFrame>(nullptr);
+    }
+    if (entry.attachmentsize > 0)
+      d_fd->initLazyAttachment(frame.get(), entry.counter + 1, entry.attachmentsize, entry.attachmentoffset);
+    return frame;
+  }
+
+  return d_fd->getFrameAt(entry.offset, entry.counter, framenumber);
+}
@@ -33,7 +33,7 @@ bool SignalBackup::importCSV(std::string const &file, std::map<std::string, std:
   if (!csvfile.ok())
     return false;
 
-  std::string statementstub("INSERT INTO sms SET (");
+  std::vector<std::string> columns;
 
   int64_t idx_of_address = -1;
   //int64_t idx_of_type = -1;
@@ -53,14 +53,17 @@ bool SignalBackup::importCSV(std::string const &file, std::map<std::string, std:
     else if (fieldname.find("date") != std::string::npos) /// not sure what this does, and if it works as intended
       date_indeces.push_back(i);                          // with d_sms_date_received
 
-    statementstub += fieldname + ',';
+    columns.push_back(fieldname);
   }
-  statementstub += "thread_id) VALUES (";
+  columns.push_back("thread_id");
 
-  // build statement from each row
+  // values are bound as text, sqlite's column affinity converts the numeric ones
+  SqliteDB::Inserter inserter(d_database.inserter("sms", columns));
+  std::vector<std::any> values(columns.size());
+
+  // insert each row
   for (uint msg = 0; msg < csvfile.rows(); ++msg)
   {
-    std::string statement = statementstub;
     for (uint f = 0; f < csvfile.fields(); ++f)
     {
       //if (f == idx_of_type)
@@ -73,7 +76,7 @@ bool SignalBackup::importCSV(std::string const &file, std::map<std::string, std:
       //    translate(date);
       //}
 
-      statement += csvfile.get(f, msg) + ',';
+      values[f] = csvfile.get(f, msg);
     }
 
     // determine thread_id
@@ -84,15 +87,10 @@ bool SignalBackup::importCSV(std::string const &file, std::map<std::string, std:
                 << " Unable to determine thread_id for message." << std::endl;
       return false;
     }
-    statement += bepaald::toString(tid);
-
-
+    values.back() = tid;
 
-    statement += ')';
-
-    if (!d_database.exec(statement))
+    if (!inserter.insert(values))
       return false;
-
   }
   return true;
 }
@@ -234,24 +234,15 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
     return false;
   }
 
-  SqlCipherDecryptor sqlcipherdecryptor(configdir, databasedir, sqlcipherversion);
+  // lazy: pages are only decrypted when the queries below read them
+  SqlCipherDecryptor sqlcipherdecryptor(configdir, databasedir, sqlcipherversion, true);
   if (!sqlcipherdecryptor.ok())
   {
     std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : Failed to open database" << std::endl;
     return false;
   }
 
-  auto [data, size] = sqlcipherdecryptor.data(); // unsigned char *, uint64_t
-
-  // disable WAL (Write-Ahead Logging) on database, reading from memory otherwise will not work
-  // see https://www.sqlite.org/fileformat.html
-  if (data[0x12] == 2)
-    data[0x12] = 1;
-  if (data[0x13] == 2)
-    data[0x13] = 1;
-
-  std::pair<unsigned char *, uint64_t> desktopdata = {data, size};
-  SqliteDB ddb(&desktopdata);
+  SqliteDB ddb(&sqlcipherdecryptor);
   if (!ddb.ok())
   {
     std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : Failed to open database" << std::endl;
@@ -333,6 +324,25 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
   // this map will map desktop-recipient-uuid's to android recipient._id's
   std::map<std::string, long long int> recipientmap;
 
+  // all inserts of the import are batched in a savepoint, which is released (committed) and
+  // started again every 'importbatchsize' messages. On an early return, the last batch is
+  // released as well, keeping everything imported so far (as without the savepoint).
+  unsigned int constexpr importbatchsize = 1000;
+  struct ImportBatch
+  {
+    SqliteDB const &db;
+    bool active;
+    ~ImportBatch()
+    {
+      if (active)
+        db.releaseSavepoint("importfromdesktop");
+    }
+  } importbatch{d_database, d_database.beginSavepoint("importfromdesktop")};
+  unsigned int messagesinbatch = 0;
+
+  // inserts inside the savepoint above, so it does not start (and commit) transactions itself
+  SqliteDB::Inserter mentioninserter(d_database.inserter("mention", {"thread_id", "message_id", "recipient_id", "range_start", "range_length"}));
+
   // for each conversation
   for (uint i = 0; i < results_all_conversations.rows(); ++i)
   {
@@ -545,6 +555,13 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
     std::cout << " - Importing " << results_all_messages_from_conversation.rows() << " messages into thread._id " << ttid << std::endl;
     for (uint j = 0; j < results_all_messages_from_conversation.rows(); ++j)
     {
+      if (++messagesinbatch == importbatchsize)
+      {
+        messagesinbatch = 0;
+        if (importbatch.active) // stays active if it could not be released
+          importbatch.active = !d_database.releaseSavepoint("importfromdesktop") || d_database.beginSavepoint("importfromdesktop");
+      }
+
       std::string type = results_all_messages_from_conversation.valueAsString(j, "type");
       if (d_verbose) [[unlikely]] std::cout << "Message " << j + 1 << "/" << results_all_messages_from_conversation.rows() << ":" << (!type.empty() ? " '" + type + "'" : "") << std::endl;
 
@@ -1469,12 +1486,9 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
             }
           }
 
-          if (!insertRow("mention",
-                         {{"thread_id", ttid},
-                          {"message_id", new_mms_id},
-                          {"recipient_id", rec_id},
-                          {"range_start", results_mentions.getValueAs<long long int>(0, "start")},
-                          {"range_length", results_mentions.getValueAs<long long int>(0, "length")}}))
+          if (!mentioninserter.insert(ttid, new_mms_id, rec_id,
+                                      results_mentions.getValueAs<long long int>(0, "start"),
+                                      results_mentions.getValueAs<long long int>(0, "length")))
           {
             std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Inserting into mention" << std::endl;
           }
@@ -1521,6 +1535,9 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
     }
     //updateThreadsEntries(ttid);
   }
+  mentioninserter.commit();
+  if (importbatch.active)
+    importbatch.active = !d_database.releaseSavepoint("importfromdesktop");
 
   for (auto const &r : recipientmap)
   {
@@ -728,8 +728,8 @@ table|sender_keys|sender_keys|71|CREATE TABLE sender_keys (_id INTEGER PRIMARY K
       //     std::cout << results.valueAsString(i, j) << " ";
       //   std::cout << std::endl;
       // }
-      SqlStatementFrame newframe = buildSqlStatementFrame(table, results.headers(), results.row(i));
-      d_database.exec(newframe.bindStatement(), newframe.parameters());
+      SqlStatementFrame newframe = buildSqlStatementFrame(table, results.headers(), results, i);
+      d_database.execWithBinder(newframe.bindStatement(), [&newframe](sqlite3_stmt *stmt) { return newframe.bindParameters(stmt); });
       //newframe.printInfo();
     }
   }
@@ -19,7 +19,9 @@
 
 #include "signalbackup.ih"
 
-void SignalBackup::initFromFile()
+// if loadtables is set, only the contents of those tables are loaded. The INSERT statements
+// for all other tables are only located, and executed when the database first needs them.
+void SignalBackup::initFromFile(std::string const &frameindexfile, std::set<std::string> const *loadtables)
 {
   if (!d_fd->ok())
   {
@@ -29,12 +31,43 @@ void SignalBackup::initFromFile()
 
   uint64_t totalsize = d_fd->total();
 
+  // with a valid frame index, frames are read directly from their recorded
+  // positions. Otherwise, the index is recorded while reading the backup
+  FrameIndex frameindex;
+  uint64_t frameindexpos = 0;
+  bool useindex = false;
+  if (!frameindexfile.empty() && bepaald::fileOrDirExists(frameindexfile))
+  {
+    useindex = d_fd->readFrameIndex(frameindexfile, &frameindex);
+    if (!useindex)
+      std::cout << "Not using frame index, it will be rewritten" << std::endl;
+  }
+  bool writeindex = !frameindexfile.empty() && !useindex;
+
   std::cout << "Reading backup file..." << std::endl;
   std::unique_ptr<BackupFrame> frame(nullptr);
 
+  // indexes are created after all data is inserted (table, statement). In exported
+  // schemas they are put back in their original place (after lastschemaobject)
+  std::vector<std::pair<std::string, std::string>> deferredindexes;
+  std::string lastschemaobject;
+
+  std::chrono::steady_clock::time_point loadstart = std::chrono::steady_clock::now();
+  std::chrono::steady_clock::duration readtime(0);
+  std::chrono::steady_clock::duration sqltime(0);
+  auto readframe = [&]()
+  {
+    if (!d_timings) [[likely]]
+      return useindex ? getFrameFromIndex(frameindex, &frameindexpos, loadtables) : d_fd->getFrame();
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    std::unique_ptr<BackupFrame> f(useindex ? getFrameFromIndex(frameindex, &frameindexpos, loadtables) : d_fd->getFrame());
+    readtime += std::chrono::steady_clock::now() - t1;
+    return f;
+  };
+
   d_database.exec("BEGIN TRANSACTION");
 
-  while ((frame = d_fd->getFrame())) // deal with bad mac??
+  while ((frame = readframe())) // deal with bad mac??
   {
     if (d_fd->badMac()) [[unlikely]]
     {
@@ -53,6 +86,27 @@ void SignalBackup::initFromFile()
         std::cout << "\n";
     }
 
+    if (writeindex)
+    {
+      FrameIndex::Entry entry{d_fd->lastFramePos(), 0, 0, 0, d_fd->lastFrameCounter(), 0, static_cast<uint32_t>(frame->frameType()), std::string()};
+      if (frame->frameType() == BackupFrame::FRAMETYPE::SQLSTATEMENT &&
+          reinterpret_cast<SqlStatementFrame *>(frame.get())->isInsertStatement())
+        entry.table = reinterpret_cast<SqlStatementFrame *>(frame.get())->tableName();
+      else if (frame->frameType() == BackupFrame::FRAMETYPE::ATTACHMENT ||
+               frame->frameType() == BackupFrame::FRAMETYPE::AVATAR ||
+               frame->frameType() == BackupFrame::FRAMETYPE::STICKER)
+      {
+        entry.attachmentoffset = reinterpret_cast<FrameWithAttachment *>(frame.get())->filepos();
+        entry.attachmentsize = frame->attachmentSize();
+        if (frame->frameType() == BackupFrame::FRAMETYPE::ATTACHMENT)
+        {
+          entry.rowid = reinterpret_cast<AttachmentFrame *>(frame.get())->rowId();
+          entry.uniqueid = reinterpret_cast<AttachmentFrame *>(frame.get())->attachmentId();
+        }
+      }
+      frameindex.add(std::move(entry));
+    }
+
     //if (frame->frameNumber() > 73085)
     //  frame->printInfo();
 
@@ -80,14 +134,43 @@ void SignalBackup::initFromFile()
 
       //std::cout << s->statement() << std::endl;
 
-      if (s->statement().find("CREATE TABLE sqlite_") == std::string::npos) [[likely]] // skip creation of sqlite_ internal db's
+      bool isinsert = s->isInsertStatement();
+      std::pair<std::string, std::string> created(isinsert ? std::make_pair(std::string(), std::string()) : s->createdObject());
+
+      if (loadtables && isinsert && loadtables->find(s->tableName()) == loadtables->end())
+        d_deferredframes.emplace_back(d_fd->lastFramePos(), d_fd->lastFrameCounter(), s->frameNumber());
+      // maintaining indexes row by row is slow, create them after the data. UNIQUE indexes are
+      // created right away though: they must keep rejecting duplicate rows (in damaged backups)
+      // as they are inserted, instead of failing to be created afterwards
+      else if (created.first == "INDEX") [[unlikely]]
+      {
+        deferredindexes.emplace_back(s->tableName(), s->bindStatement());
+        d_movedschemaobjects.emplace_back(created.second, lastschemaobject);
+        lastschemaobject = created.second;
+      }
+      else if (isinsert || s->bindStatement().find("CREATE TABLE sqlite_") == std::string::npos) [[likely]] // skip creation of sqlite_ internal db's
       {
         // NOTE: in the official import, there are other tables that are skipped (virtual tables for search data)
         // we lazily do not check for them here, since we are dealing with official exported files which do not contain
         // these tables as they are excluded on the export-side as well. Additionally, the official import should be able
         // to properly deal with them anyway (that is: ignore them)
-        if (!d_database.exec(s->bindStatement(), s->parameters()))
+        std::chrono::steady_clock::time_point t1;
+        if (d_timings) [[unlikely]]
+          t1 = std::chrono::steady_clock::now();
+        if (!d_database.execWithBinder(s->bindStatement(), [s](sqlite3_stmt *stmt) { return s->bindParameters(stmt); }))
           std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Failed to execute statement: " << s->statement() << std::endl;
+        else if (!created.second.empty())
+          lastschemaobject = created.second;
+        if (d_timings) [[unlikely]]
+          sqltime += std::chrono::steady_clock::now() - t1;
+
+        if (!isinsert && isExternalContentFts(s->bindStatement())) [[unlikely]]
+        {
+          // the search index is filled by triggers on every insert into the content table,
+          // skip that during the load, the whole index is rebuilt in one go when needed
+          d_deferredftstables.insert(s->tableName());
+          d_database.setIgnoredTriggerWrites(d_deferredftstables);
+        }
       }
       #ifdef BUILT_FOR_TESTING
       else if (s->statement().find("CREATE TABLE sqlite_sequence") != std::string::npos)
@@ -98,6 +181,7 @@ void SignalBackup::initFromFile()
         d_database.exec("CREATE TABLE dummy (_id INTEGER PRIMARY KEY AUTOINCREMENT)");
         d_database.exec("DROP TABLE dummy");
         d_found_sqlite_sequence_in_backup = true;
+        lastschemaobject = "sqlite_sequence";
       }
       #endif
     }
@@ -137,8 +221,62 @@ void SignalBackup::initFromFile()
     }
   }
 
+  std::set<std::string> deferredtables;
+  if (!d_deferredframes.empty())
+  {
+    SqliteDB::QueryResults results;
+    if (d_database.exec("SELECT name FROM sqlite_master WHERE type = 'table'", &results))
+      for (size_t i = 0; i < results.rows(); ++i)
+        if (loadtables->find(results.valueAsString(i, "name")) == loadtables->end())
+          deferredtables.insert(results.valueAsString(i, "name"));
+  }
+
+  // indexes on tables that were not loaded are created when they are
+  std::chrono::steady_clock::time_point indexstart = std::chrono::steady_clock::now();
+  std::vector<std::pair<std::string, std::string>> indexes;
+  for (auto &index : deferredindexes)
+    if (deferredtables.find(index.first) != deferredtables.end())
+      d_deferredindexes.emplace_back(std::move(index));
+    else
+      indexes.emplace_back(std::move(index));
+  createIndexes(&indexes);
+  std::chrono::steady_clock::duration indextime(std::chrono::steady_clock::now() - indexstart);
+
   d_database.exec("COMMIT");
 
+  if (d_verbose) [[unlikely]]
+    d_database.printStatementCacheStats();
+
+  if (d_timings) [[unlikely]]
+  {
+    auto seconds = [](std::chrono::steady_clock::duration d) { return std::chrono::duration<double>(d).count(); };
+    std::cout << std::endl << std::fixed << std::setprecision(3)
+              << "Load timings:" << std::endl
+              << "  Reading frames        : " << seconds(readtime) << "s" << std::endl
+              << "  Executing statements  : " << seconds(sqltime) << "s" << std::endl
+              << "  Creating indexes      : " << seconds(indextime) << "s (" << indexes.size() << " indexes, after data)" << std::endl
+              << "  Total                 : " << seconds(std::chrono::steady_clock::now() - loadstart) << "s" << std::endl
+              << std::defaultfloat;
+    if (bepaald::peakMemoryUsage() >= 0)
+      std::cout << "  Peak memory use       : " << bepaald::peakMemoryUsage() / (1024 * 1024) << "MB ("
+                << (s_workdbdir.empty() ? "database in memory" : "database in file") << ")" << std::endl;
+  }
+
+  if (!d_deferredframes.empty())
+  {
+    d_database.addDeferredLoad(deferredtables, true, [this]() { return loadDeferredFrames(); });
+    if (d_verbose) [[unlikely]]
+      std::cout << "Deferred " << d_deferredframes.size() << " statements on " << deferredtables.size() << " tables until needed" << std::endl;
+  }
+
+  // after the deferred data, the index needs it
+  if (!d_deferredftstables.empty())
+  {
+    d_database.addDeferredLoad(d_deferredftstables, false, [this]() { return rebuildFtsTables(); });
+    if (d_verbose) [[unlikely]]
+      std::cout << "Deferred building " << d_deferredftstables.size() << " full-text search index(es) until needed" << std::endl;
+  }
+
   if (!d_badattachments.empty())
   {
     std::cout << "Attachment data with BAD MAC was encountered:" << std::endl;
@@ -154,6 +292,10 @@ void SignalBackup::initFromFile()
 
   std::cout << "done!" << std::endl;
 
+  // only index complete, verified backups
+  if (writeindex && d_endframe && !d_fd->badMac() && d_fd->writeFrameIndex(frameindexfile, frameindex))
+    std::cout << "Wrote frame index to '" << frameindexfile << "'" << std::endl;
+
   if (!d_endframe)
   {
     std::cout << bepaald::bold_on << "WARNING " << bepaald::bold_off
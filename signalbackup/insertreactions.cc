@@ -25,6 +25,14 @@ void SignalBackup::insertReactions(long long int message_id, std::vector<std::ve
   if (d_verbose && reactions.size()) [[unlikely]]
     std::cout << "Inserting " << reactions.size() << " message reactions." << std::endl;
 
+  if (reactions.empty())
+    return;
+
+  bool hasismms = d_database.tableContainsColumn("reaction", "is_mms"); // not actually removed yet? just unused...
+  SqliteDB::Inserter inserter(hasismms ?
+                              d_database.inserter("reaction", {"message_id", "is_mms", "author_id", "emoji", "date_sent", "date_received"}) :
+                              d_database.inserter("reaction", {"message_id", "author_id", "emoji", "date_sent", "date_received"}));
+
   // insert into reactions
   for (auto const &r : reactions)
   {
@@ -43,28 +51,10 @@ void SignalBackup::insertReactions(long long int message_id, std::vector<std::ve
       std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off << ": Reaction author not found. Skipping" << std::endl;
       continue;
     }
-    if (d_database.tableContainsColumn("reaction", "is_mms")) // not actually removed yet? just unused...
-    {
-      if (!insertRow("reaction",
-                     {{"message_id", message_id},
-                      {"is_mms", mms ? 1 : 0},
-                      {"author_id", author},
-                      {"emoji", r[0]},
-                      {"date_sent", bepaald::toNumber<long long int>(r[1])},
-                      {"date_received", bepaald::toNumber<long long int>(r[1])}}))
-      {
-        std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to insert into reaction table" << std::endl;
-      }
-    }
-    else
-    {
-      if (!insertRow("reaction",
-                     {{"message_id", message_id},
-                      {"author_id", author},
-                      {"emoji", r[0]},
-                      {"date_sent", bepaald::toNumber<long long int>(r[1])},
-                      {"date_received", bepaald::toNumber<long long int>(r[1])}}))
-        std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to insert into reaction table" << std::endl;
-    }
+    long long int timestamp = bepaald::toNumber<long long int>(r[1]);
+    if (!(hasismms ?
+          inserter.insert(message_id, mms ? 1 : 0, author, r[0], timestamp, timestamp) :
+          inserter.insert(message_id, author, r[0], timestamp, timestamp)))
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to insert into reaction table" << std::endl;
   }
 }
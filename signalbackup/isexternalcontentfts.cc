@@ -0,0 +1,45 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+// checks if statement creates an FTS table with external content ("CREATE VIRTUAL TABLE x
+// USING fts5(..., content=y, ...)"), the index of those can be rebuilt from the content table
+bool SignalBackup::isExternalContentFts(std::string const &statement) // static
+{
+  std::string lc(bepaald::toLower(statement));
+  if (!STRING_STARTS_WITH(lc, "create virtual table"))
+    return false;
+
+  std::string::size_type pos = lc.find(" using fts");
+  if (pos == std::string::npos)
+    return false;
+
+  // find 'content' option (not 'content_rowid')
+  while ((pos = lc.find("content", pos)) != std::string::npos)
+  {
+    pos += STRLEN("content");
+    std::string::size_type eq = lc.find_first_not_of(" \t\n", pos);
+    if (eq == std::string::npos || lc[eq] != '=')
+      continue;
+    std::string::size_type valuestart = lc.find_first_not_of(" \t\n'\"`[", eq + 1);
+    return valuestart != std::string::npos && std::string(",)'\"`]").find(lc[valuestart]) == std::string::npos; // not contentless (content='')
+  }
+  return false;
+}
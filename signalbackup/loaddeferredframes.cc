@@ -0,0 +1,65 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+// executes the statements that were skipped by a partial load (see initFromFile()),
+// called by the database right before it first needs their tables
+bool SignalBackup::loadDeferredFrames()
+{
+  if (d_deferredframes.empty())
+    return true;
+
+  if (d_verbose) [[unlikely]]
+    std::cout << "Loading " << d_deferredframes.size() << " deferred statements..." << std::endl;
+
+  auto t1 = std::chrono::steady_clock::now();
+
+  if (!d_database.exec("SAVEPOINT deferredload"))
+    return false;
+
+  for (auto const &[filepos, counter, framenumber] : d_deferredframes)
+  {
+    std::unique_ptr<BackupFrame> frame(d_fd->getFrameAt(filepos, counter, framenumber));
+    if (!frame || d_fd->badMac() || frame->frameType() != BackupFrame::FRAMETYPE::SQLSTATEMENT) [[unlikely]]
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to read deferred frame " << framenumber << std::endl;
+      d_database.exec("ROLLBACK TO deferredload");
+      d_database.exec("RELEASE deferredload");
+      return false;
+    }
+
+    SqlStatementFrame *s = reinterpret_cast<SqlStatementFrame *>(frame.get());
+    if (!d_database.execWithBinder(s->bindStatement(), [s](sqlite3_stmt *stmt) { return s->bindParameters(stmt); }))
+      std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Failed to execute statement: " << s->statement() << std::endl;
+  }
+  createIndexes(&d_deferredindexes);
+
+  if (!d_database.exec("RELEASE deferredload"))
+    return false;
+
+  d_deferredframes.clear();
+  d_deferredindexes.clear();
+
+  if (d_timings) [[unlikely]]
+    std::cout << "Loaded deferred statements in " << std::fixed << std::setprecision(3)
+              << std::chrono::duration<double>(std::chrono::steady_clock::now() - t1).count() << "s" << std::defaultfloat << std::endl;
+
+  return true;
+}
@@ -28,7 +28,7 @@ bool SignalBackup::migrateDatabase(int from [[maybe_unused]], int to [[maybe_unu
 
   std::cout << "Attempting to migrate database from version " << from << " to version " << to << "..." << std::endl;
 
-  if (!d_database.exec("BEGIN TRANSACTION"))
+  if (!d_database.beginSavepoint("migration"))
     return false;
 
   // create reaction table if not present
@@ -36,7 +36,7 @@ bool SignalBackup::migrateDatabase(int from [[maybe_unused]], int to [[maybe_unu
   {
     if (!d_database.exec("CREATE TABLE reaction (_id INTEGER PRIMARY KEY, message_id INTEGER NOT NULL, is_mms INTEGER NOT NULL, author_id INTEGER NOT NULL REFERENCES recipient (_id) ON DELETE CASCADE, emoji TEXT NOT NULL, date_sent INTEGER NOT NULL, date_received INTEGER NOT NULL, UNIQUE(message_id, is_mms, author_id) ON CONFLICT REPLACE)"))
     {
-      d_database.exec("ROLLBACK TRANSACTION");
+      d_database.rollbackSavepoint("migration");
       return false;
     }
 
@@ -58,7 +58,7 @@ bool SignalBackup::migrateDatabase(int from [[maybe_unused]], int to [[maybe_unu
                           {"date_sent", reactions.getSentTime(j)},
                           {"date_received", reactions.getReceivedTime(j)}}))
           {
-            d_database.exec("ROLLBACK TRANSACTION");
+            d_database.rollbackSavepoint("migration");
             return false;
           }
         }
@@ -88,7 +88,7 @@ bool SignalBackup::migrateDatabase(int from [[maybe_unused]], int to [[maybe_unu
   {
     if (!ensureColumns(d_mms_table, p.first, p.second))
     {
-      d_database.exec("ROLLBACK TRANSACTION");
+      d_database.rollbackSavepoint("migration");
       return false;
     }
   }
@@ -99,7 +99,7 @@ bool SignalBackup::migrateDatabase(int from [[maybe_unused]], int to [[maybe_unu
   {
     if (!ensureColumns("sms", p.first, p.second))
     {
-      d_database.exec("ROLLBACK TRANSACTION");
+      d_database.rollbackSavepoint("migration");
       return false;
     }
   }
@@ -124,14 +124,14 @@ bool SignalBackup::migrateDatabase(int from [[maybe_unused]], int to [[maybe_unu
       !d_database.exec("DROP INDEX IF EXISTS mms_id_type_payment_transactions_index") ||
       !d_database.exec("DROP TRIGGER IF EXISTS mms_ai"))
   {
-    d_database.exec("ROLLBACK TRANSACTION");
+    d_database.rollbackSavepoint("migration");
     return false;
   }
 
   SqliteDB::QueryResults minmax;
   if (!d_database.exec("SELECT MIN(_id) AS min, MAX(_id) AS max FROM sms", &minmax))
   {
-    d_database.exec("ROLLBACK TRANSACTION");
+    d_database.rollbackSavepoint("migration");
     return false;
   }
 
@@ -243,7 +243,7 @@ bool SignalBackup::migrateDatabase(int from [[maybe_unused]], int to [[maybe_unu
                          "_id IS ? RETURNING _id", i, &newmmsid))
     {
       std::cout << "Error copying sms._id: " << i << std::endl;
-      d_database.exec("ROLLBACK TRANSACTION");
+      d_database.rollbackSavepoint("migration");
       return false;
     }
 
@@ -254,7 +254,7 @@ bool SignalBackup::migrateDatabase(int from [[maybe_unused]], int to [[maybe_unu
       // update reactions
       if (!d_database.exec("UPDATE reaction SET message_id = ?, is_mms = 1 WHERE message_id IS ? AND is_mms = 0", {newestmmsid, i}))
       {
-        d_database.exec("ROLLBACK TRANSACTION");
+        d_database.rollbackSavepoint("migration");
         return false;
       }
 
@@ -263,7 +263,7 @@ bool SignalBackup::migrateDatabase(int from [[maybe_unused]], int to [[maybe_unu
       {
         if (!d_database.exec("UPDATE msl_message SET message_id = ?, is_mms = 1 WHERE message_id IS ? AND is_mms = 0", {newestmmsid, i}))
         {
-          d_database.exec("ROLLBACK TRANSACTION");
+          d_database.rollbackSavepoint("migration");
           return false;
         }
       }
@@ -272,7 +272,7 @@ bool SignalBackup::migrateDatabase(int from [[maybe_unused]], int to [[maybe_unu
 
   if (!d_database.exec("DROP TABLE sms"))
   {
-    d_database.exec("ROLLBACK TRANSACTION");
+    d_database.rollbackSavepoint("migration");
     return false;
   }
 
@@ -290,11 +290,11 @@ bool SignalBackup::migrateDatabase(int from [[maybe_unused]], int to [[maybe_unu
        !d_database.exec("CREATE INDEX mms_id_type_payment_transactions_index ON mms (_id, " + d_mms_type + ") WHERE " + d_mms_type + " & " + bepaald::toString(Types::SPECIAL_TYPE_PAYMENTS_NOTIFICATION) + " != 0") ||
        !d_database.exec("CREATE TRIGGER mms_ai AFTER INSERT ON mms BEGIN INSERT INTO mms_fts (rowid, body, thread_id) VALUES (new._id, new.body, new.thread_id); END;"))
   {
-    d_database.exec("ROLLBACK TRANSACTION");
+    d_database.rollbackSavepoint("migration");
     return false;
   }
 
-  if (d_database.exec("COMMIT"))
+  if (d_database.releaseSavepoint("migration"))
     return true;
 
   return false;
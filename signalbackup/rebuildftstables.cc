@@ -0,0 +1,49 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+// fills the full-text search indexes that were skipped while loading the
+// backup (see initFromFile()), called by the database when first needed
+bool SignalBackup::rebuildFtsTables()
+{
+  if (d_deferredftstables.empty())
+    return true;
+
+  auto t1 = std::chrono::steady_clock::now();
+
+  bool ret = true;
+  for (std::string const &table : d_deferredftstables)
+    if (!d_database.exec("INSERT INTO " + table + "(" + table + ") VALUES('rebuild')"))
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to rebuild search index '" << table << "'" << std::endl;
+      ret = false;
+    }
+
+  // from now on, the triggers keep the index up to date
+  d_database.setIgnoredTriggerWrites(std::set<std::string>());
+
+  if (d_verbose || d_timings) [[unlikely]]
+    std::cout << "Rebuilt " << d_deferredftstables.size() << " full-text search index(es) in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - t1).count()
+              << "ms" << std::endl;
+
+  d_deferredftstables.clear();
+  return ret;
+}
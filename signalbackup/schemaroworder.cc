@@ -0,0 +1,56 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+// returns the row order of a 'SELECT sql, name, type FROM sqlite_master' query as
+// it was in the backup file: indexes are created after the data when loading, which
+// moves them to the end of sqlite_master
+std::vector<unsigned int> SignalBackup::schemaRowOrder(SqliteDB::QueryResults const &results) const
+{
+  std::vector<unsigned int> order(results.rows());
+  std::iota(order.begin(), order.end(), 0);
+
+  auto findrow = [&](std::string const &name)
+  {
+    return std::find_if(order.begin(), order.end(), [&](unsigned int i)
+    {
+      return results.valueHasType<std::string>(i, 1) && results.getValueAs<std::string>(i, 1) == name;
+    });
+  };
+
+  for (auto const &[name, after] : d_movedschemaobjects)
+  {
+    auto row = findrow(name);
+    if (row == order.end())
+      continue;
+    unsigned int idx = *row;
+    order.erase(row);
+
+    auto pos = order.begin();
+    if (!after.empty())
+    {
+      pos = findrow(after);
+      if (pos != order.end()) // else: should not happen, leave it at the end
+        ++pos;
+    }
+    order.insert(pos, idx);
+  }
+  return order;
+}
@@ -35,6 +35,8 @@
 #include "../sqlstatementframe/sqlstatementframe.h"
 
 #include <map>
+#include <functional>
+#include <tuple>
 #include <set>
 #include <unordered_set>
 #include <string>
@@ -99,6 +101,12 @@ class SignalBackup
   bool d_verbose;
   std::set<std::string> d_warningsgiven;
   long long int d_selfid;
+  unsigned int d_numthreads;
+  std::vector<std::tuple<uint64_t, uint32_t, uint64_t>> d_deferredframes; // filepos, counter, framenumber of statements not yet executed
+  std::set<std::string> d_deferredftstables; // search indexes not yet built
+  std::vector<std::pair<std::string, std::string>> d_deferredindexes; // table, statement of indexes on deferred tables
+  std::vector<std::pair<std::string, std::string>> d_movedschemaobjects; // index, object it followed in the original schema
+  bool d_timings;
   std::string  d_selfuuid;
 
   enum DBLinkFlag : int
@@ -156,6 +164,13 @@ class SignalBackup
     operator bool() const { return (width != -1 && height != -1 && !filetype.empty() && filesize != 0); }
   };
 
+  struct AttachmentFile // an attachment, avatar or sticker to be written by exportBackupToDir()
+  {
+    FrameWithAttachment *frame;
+    std::string basefilename;
+    bool dropattachmentdata;
+  };
+
   struct RecipientInfo
   {
     std::string display_name;
@@ -174,17 +189,22 @@ class SignalBackup
   static std::unordered_set<char> const s_emoji_first_bytes;
   static unsigned int constexpr s_emoji_min_size = 2; // smallest emoji_unicode_size - 1
   static std::map<std::string, std::string> const s_html_colormap;
+  inline static std::string s_workdbdir;
 
  public:
   inline SignalBackup(std::string const &filename, std::string const &passphrase, bool verbose,
                       bool showprogress, bool replaceattachments);
   inline SignalBackup(std::string const &filename, std::string const &passphrase, bool verbose,
                       bool showprogress, bool replaceattachment, bool assumebadframesizeonbadmac,
-                      std::vector<long long int> editattachments, bool stoponerror);
+                      std::vector<long long int> editattachments, bool stoponerror, unsigned int numthreads = 1, bool usemmap = false,
+                      std::string const &frameindex = std::string(), std::set<std::string> const *loadtables = nullptr,
+                      bool timings = false);
   [[nodiscard]] inline bool exportBackup(std::string const &filename, std::string const &passphrase,
-                                         bool overwrite, bool keepattachmentdatainmemory, bool onlydb = false);
+                                         bool overwrite, bool keepattachmentdatainmemory, bool onlydb = false,
+                                         unsigned int maxoutstandingfiles = 0);
   bool exportXml(std::string const &filename, bool overwrite, std::string self, bool includemms = false, bool keepattachmentdatainmemory = true) const;
   void exportCsv(std::string const &filename, std::string const &table) const;
+  void exportCsv(std::vector<std::pair<std::string, std::string>> const &tablesandfiles) const;
   void listThreads() const;
   void listRecipients() const;
   void cropToThread(long long int threadid);
@@ -197,6 +217,11 @@ class SignalBackup
   bool importThread(SignalBackup *source, long long int thread);
   //bool importThread(SignalBackup *source, std::vector<long long int> const &threads);
   inline bool ok() const;
+  inline static void setWorkingDatabaseDir(std::string const &dir);
+  static bool transcodeBackup(std::string const &input, std::string const &passphrase,
+                              std::string const &output, std::string const &opassphrase, bool overwrite,
+                              std::function<bool(BackupFrame const *)> const &keepframe,
+                              bool verbose, bool showprogress, unsigned int numthreads = 1, bool usemmap = false);
   bool dropBadFrames();
   //void fillThreadTableFromMessages();
   inline void addEndFrame();
@@ -245,8 +270,18 @@ class SignalBackup
  private:
   [[nodiscard]] bool exportBackupToFile(std::string const &filename, std::string const &passphrase,
                                         bool overwrite, bool keepattachmentdatainmemory);
-  [[nodiscard]] bool exportBackupToDir(std::string const &directory, bool overwrite, bool keepattachmentdatainmemory, bool onlydb);
-  void initFromFile();
+  [[nodiscard]] bool exportBackupToDir(std::string const &directory, bool overwrite, bool keepattachmentdatainmemory, bool onlydb,
+                                       unsigned int maxoutstandingfiles);
+  [[nodiscard]] bool writeAttachmentFile(AttachmentFile const &file) const;
+  [[nodiscard]] bool writeAttachmentFiles(std::vector<AttachmentFile> const &files, unsigned int maxoutstandingfiles) const;
+  void initFromFile(std::string const &frameindex, std::set<std::string> const *loadtables);
+  std::unique_ptr<BackupFrame> getFrameFromIndex(FrameIndex const &index, uint64_t *pos, std::set<std::string> const *loadtables);
+  bool loadDeferredFrames();
+  bool rebuildFtsTables();
+  static bool isExternalContentFts(std::string const &statement);
+  static std::string workingDatabaseName();
+  bool createIndexes(std::vector<std::pair<std::string, std::string>> *indexes);
+  std::vector<unsigned int> schemaRowOrder(SqliteDB::QueryResults const &results) const;
   void initFromDir(std::string const &inputdir, bool replaceattachments);
   void updateThreadsEntries(long long int thread = -1);
   long long int getMaxUsedId(std::string const &table, std::string const &col = "_id") const;
@@ -256,11 +291,12 @@ class SignalBackup
   template <typename T>
   [[nodiscard]] inline bool writeRawFrameDataToFile(std::string const &outputfile, std::unique_ptr<T> const &frame) const;
   [[nodiscard]] inline bool writeFrameDataToFile(std::ofstream &outputfile, std::pair<unsigned char *, uint64_t> const &data) const;
-  [[nodiscard]] bool writeEncryptedFrame(std::ofstream &outputfile, BackupFrame *frame);
-  [[nodiscard]] bool writeEncryptedFrameWithoutAttachment(std::ofstream &outputfile, std::pair<unsigned char *, uint64_t> framedata);
+  [[nodiscard]] inline bool writeEncryptedFrame(BackupFrame *frame, bool dropattachmentdata = false);
+  [[nodiscard]] static bool writeEncryptedFrame(FileEncryptor *fe, BackupFrame *frame, bool dropattachmentdata);
   SqlStatementFrame buildSqlStatementFrame(std::string const &table, std::vector<std::string> const &headers,
-                                           std::vector<std::any> const &result) const;
-  SqlStatementFrame buildSqlStatementFrame(std::string const &table, std::vector<std::any> const &result) const;
+                                           SqliteDB::QueryResults const &results, size_t row) const;
+  SqlStatementFrame buildSqlStatementFrame(std::string const &table, SqliteDB::QueryResults const &results, size_t row) const;
+  static void addStatementParameter(SqlStatementFrame *frame, SqliteDB::QueryResults const &results, size_t row, size_t column);
   template <typename T>
   inline bool setFrameFromFile(std::unique_ptr<T> *frame, std::string const &file, bool quiet = false) const;
   template <typename T>
@@ -291,6 +327,7 @@ class SignalBackup
   void dumpInfoOnBadFrame(std::unique_ptr<BackupFrame> *frame);
   void dumpInfoOnBadFrames() const;
   void duplicateQuotes(std::string *s) const;
+  void exportCsv(SqliteDB const &database, std::string const &filename, std::string const &table) const;
   std::string decodeStatusMessage(std::string const &body, long long int expiration, long long int type,
                                   std::string const &contactname, IconType *icon = nullptr) const;
   void escapeXmlString(std::string *s) const;
@@ -403,14 +440,15 @@ class SignalBackup
 inline SignalBackup::SignalBackup(std::string const &filename, std::string const &passphrase,
                                   bool verbose, bool showprogress, bool replaceattachments)
   :
-  SignalBackup(filename, passphrase, verbose, showprogress, replaceattachments, false, std::vector<long long int>(), false)
+  SignalBackup(filename, passphrase, verbose, showprogress, replaceattachments, false, std::vector<long long int>(), false, 1, false, std::string(), nullptr, false)
 {}
 
 inline SignalBackup::SignalBackup(std::string const &filename, std::string const &passphrase, bool verbose,
                                   bool showprogress, bool replaceattachments, bool assumebadframesizeonbadmac,
-                                  std::vector<long long int> editattachments, bool stoponerror)
+                                  std::vector<long long int> editattachments, bool stoponerror, unsigned int numthreads, bool usemmap,
+                                  std::string const &frameindex, std::set<std::string> const *loadtables, bool timings)
   :
-  d_database(":memory:"),
+  d_database(workingDatabaseName(), false),
   d_passphrase(passphrase),
   d_found_sqlite_sequence_in_backup(false),
   d_ok(false),
@@ -418,14 +456,22 @@ inline SignalBackup::SignalBackup(std::string const &filename, std::string const
   d_showprogress(showprogress),
   d_stoponerror(stoponerror),
   d_verbose(verbose),
-  d_selfid(-1)
+  d_selfid(-1),
+  d_numthreads(numthreads ? numthreads : 1),
+  d_timings(timings)
 {
+  if (!s_workdbdir.empty() && !d_database.setupWorkingFile())
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : Failed to set up working database in '" << s_workdbdir << "'" << std::endl;
+    return;
+  }
+
   if (bepaald::isDir(filename))
     initFromDir(filename, replaceattachments);
   else // not directory
   {
-    d_fd.reset(new FileDecryptor(filename, passphrase, d_verbose, stoponerror, assumebadframesizeonbadmac, editattachments));
-    initFromFile();
+    d_fd.reset(new FileDecryptor(filename, passphrase, d_verbose, stoponerror, assumebadframesizeonbadmac, editattachments, d_numthreads, usemmap));
+    initFromFile(frameindex, loadtables);
   }
 
   if (d_ok) // set by initfrom()
@@ -433,15 +479,17 @@ inline SignalBackup::SignalBackup(std::string const &filename, std::string const
 
   std::cout << "Database version: " << d_databaseversion << std::endl;
 
-  checkDbIntegrity(true);
+  // with a partial load, this is done when the remaining data is loaded
+  if (d_deferredframes.empty())
+    checkDbIntegrity(true);
 }
 
 inline bool SignalBackup::exportBackup(std::string const &filename, std::string const &passphrase, bool overwrite,
-                                       bool keepattachmentdatainmemory, bool onlydb)
+                                       bool keepattachmentdatainmemory, bool onlydb, unsigned int maxoutstandingfiles)
 {
   // if output is existing directory
   if (bepaald::fileOrDirExists(filename) && bepaald::isDir(filename))
-    return exportBackupToDir(filename, overwrite, keepattachmentdatainmemory, onlydb);
+    return exportBackupToDir(filename, overwrite, keepattachmentdatainmemory, onlydb, maxoutstandingfiles);
 
   // if output does not exist, but ends in directory delimiter
   if (!bepaald::fileOrDirExists(filename) &&
@@ -454,7 +502,7 @@ inline bool SignalBackup::exportBackup(std::string const &filename, std::string
       std::cout << "Error: Failed to create directory \"" << filename << "\"" << std::endl;
       return false;
     }
-    return exportBackupToDir(filename, overwrite, keepattachmentdatainmemory, onlydb);
+    return exportBackupToDir(filename, overwrite, keepattachmentdatainmemory, onlydb, maxoutstandingfiles);
   }
 
   // export to file
@@ -466,6 +514,11 @@ inline bool SignalBackup::ok() const
   return d_ok;
 }
 
+inline void SignalBackup::setWorkingDatabaseDir(std::string const &dir) // static
+{
+  s_workdbdir = dir;
+}
+
 template <typename T>
 inline bool SignalBackup::writeRawFrameDataToFile(std::string const &outputfile, T *frame) const
 {
@@ -514,6 +567,11 @@ inline bool SignalBackup::writeFrameDataToFile(std::ofstream &outputfile, std::p
   return true;
 }
 
+inline bool SignalBackup::writeEncryptedFrame(BackupFrame *frame, bool dropattachmentdata)
+{
+  return writeEncryptedFrame(&d_fe, frame, dropattachmentdata);
+}
+
 template <typename T>
 inline std::pair<unsigned char*, size_t> SignalBackup::numToData(T num) const
 {
@@ -650,14 +708,30 @@ inline void SignalBackup::addEndFrame()
 inline void SignalBackup::runQuery(std::string const &q, bool pretty) const
 {
   std::cout << " * Executing query: " << q << std::endl;
-  SqliteDB::QueryResults res;
-  if (!d_database.exec(q, &res))
-    return;
 
   std::string q_comm = q.substr(0, STRLEN("DELETE")); // delete, insert and update are same length...
   std::for_each(q_comm.begin(), q_comm.end(), [] (char &ch) { ch = std::toupper(ch); });
+  bool modifies = (q_comm == "DELETE" || q_comm == "INSERT" || q_comm == "UPDATE");
+
+  // print rows as they come in. Not for pretty printing, which needs all rows to get the
+  // column widths, and not for modifying statements, whose (RETURNING) rows are printed
+  // after the number of modified rows, which is only known when all are done
+  if (!pretty && !modifies)
+  {
+    SqliteDB::Cursor cursor(d_database.query(q));
+    bool first = true;
+    for (; cursor.step(); first = false)
+      cursor.row().print(first);
+    if (cursor.ok() && first)
+      SqliteDB::QueryResults().print();
+    return;
+  }
+
+  SqliteDB::QueryResults res;
+  if (!d_database.exec(q, &res))
+    return;
 
-  if (q_comm == "DELETE" || q_comm == "INSERT" || q_comm == "UPDATE")
+  if (modifies)
   {
     std::cout << "Modified " << d_database.changed() << " rows" << std::endl;
     if (res.rows() == 0 && res.columns() == 0)
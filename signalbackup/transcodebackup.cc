@@ -0,0 +1,197 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+// copies the backup in 'input' frame by frame to 'output', re-encrypted with 'opassphrase'
+// (or the input passphrase if empty). The database is never loaded, every frame is written
+// and destroyed before the next is read, so memory use does not depend on the size of the
+// backup. Frames for which 'keepframe' returns false are not written (their attachment
+// data is never even read). Without 'output', all frames and attachments are only decrypted
+// and verified.
+bool SignalBackup::transcodeBackup(std::string const &input, std::string const &passphrase,
+                                   std::string const &output, std::string const &opassphrase, bool overwrite,
+                                   std::function<bool(BackupFrame const *)> const &keepframe,
+                                   bool verbose, bool showprogress, unsigned int numthreads, bool usemmap) // static
+{
+  bool verifyonly = output.empty();
+  std::cout << std::endl << (verifyonly ? "Verifying" : "Transcoding") << " backup '" << input << "'" << std::endl;
+
+  if (bepaald::isDir(input))
+  {
+    std::cout << "Error: input is a directory, transcoding requires a backup file" << std::endl;
+    return false;
+  }
+
+  if (!verifyonly && bepaald::fileOrDirExists(output))
+  {
+    if (!overwrite)
+    {
+      std::cout << "File " << output << " exists, use --overwrite to overwrite" << std::endl;
+      return false;
+    }
+    std::error_code ec;
+    if (std::filesystem::equivalent(input, output, ec))
+    {
+      std::cout << "Error: output file is the input file" << std::endl;
+      return false;
+    }
+  }
+
+  FileDecryptor fd(input, passphrase, verbose, false, false, std::vector<long long int>(), numthreads, usemmap);
+  if (!fd.ok())
+  {
+    std::cout << "Error: failed to open backup file" << std::endl;
+    return false;
+  }
+  uint64_t totalsize = fd.total();
+
+  // the first frame is the (unencrypted) HeaderFrame, the output uses the same salt and iv
+  std::unique_ptr<BackupFrame> frame(fd.getFrame());
+  if (!frame || frame->frameType() != BackupFrame::FRAMETYPE::HEADER)
+  {
+    std::cout << "Error: HeaderFrame not found" << std::endl;
+    return false;
+  }
+  HeaderFrame *headerframe = reinterpret_cast<HeaderFrame *>(frame.get());
+
+  FileEncryptor fe;
+  std::ofstream outputfile;
+  if (!verifyonly)
+  {
+    std::string newpw = opassphrase.empty() ? passphrase : opassphrase;
+    if (newpw.empty())
+    {
+      std::cout << "Need password to create encrypted backup file." << std::endl;
+      return false;
+    }
+
+    if (!fe.init(newpw, headerframe->salt(), headerframe->salt_length(), headerframe->iv(), headerframe->iv_length(), headerframe->version()))
+    {
+      std::cout << "Error initializing FileEncryptor" << std::endl;
+      return false;
+    }
+
+    outputfile.open(output, std::ios_base::binary);
+    if (!outputfile.is_open())
+    {
+      std::cout << "Error: failed to open '" << output << "' for writing" << std::endl;
+      return false;
+    }
+
+    std::pair<unsigned char *, uint64_t> framedata = headerframe->getData();
+    if (!framedata.first)
+    {
+      std::cout << "Error getting HeaderFrame data" << std::endl;
+      return false;
+    }
+    uint32_t besize = bepaald::swap_endian(static_cast<uint32_t>(framedata.second));
+    bool writeok = outputfile.write(reinterpret_cast<char *>(&besize), sizeof(uint32_t)) &&
+      outputfile.write(reinterpret_cast<char *>(framedata.first), framedata.second);
+    delete[] framedata.first;
+    if (!writeok)
+    {
+      std::cout << "Error writing HeaderFrame to file" << std::endl;
+      return false;
+    }
+
+    // frames are only staged: the encryption pipeline would have to keep every frame
+    // alive until it is written, which is exactly what this mode avoids
+    fe.setOutputFile(&outputfile);
+  }
+
+  uint64_t badframes = 0;
+  uint64_t lastframenumber = frame->frameNumber();
+  bool endfound = false;
+  while ((frame = fd.getFrame()))
+  {
+    lastframenumber = frame->frameNumber();
+
+    if (showprogress) [[likely]]
+    {
+      std::cout << (verbose ? "" : "\33[2K\r") << "FRAME " << frame->frameNumber() << " ("
+                << std::fixed << std::setprecision(1) << std::setw(5) << std::setfill('0')
+                << (static_cast<float>(fd.curFilePos()) / totalsize) * 100 << "%)" << std::defaultfloat
+                << "... " << std::flush;
+      if (verbose) [[unlikely]]
+        std::cout << "\n";
+    }
+
+    // only old (version 0) backups return frames that failed verification, newer
+    // versions cannot be read beyond a bad frame (see below)
+    if (fd.badMac()) [[unlikely]]
+    {
+      std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Corrupted frame encountered ("
+                << frame->frameTypeString() << "). Skipping frame." << std::endl;
+      ++badframes;
+      continue;
+    }
+
+    if (frame->frameType() == BackupFrame::FRAMETYPE::END)
+      endfound = true;
+
+    if (verifyonly)
+    {
+      if (frame->attachmentSize() > 0 &&
+          BaseDecryptor::getAttachmentBlocks(reinterpret_cast<FrameWithAttachment *>(frame.get()), true, nullptr) != 0)
+      {
+        std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Corrupted attachment data encountered ("
+                  << frame->frameTypeString() << ")." << std::endl;
+        ++badframes;
+      }
+    }
+    else if ((!keepframe || keepframe(frame.get())) &&
+             !writeEncryptedFrame(&fe, frame.get(), true))
+    {
+      fe.setOutputFile(nullptr);
+      return false;
+    }
+
+    if (endfound)
+      break;
+  }
+  if (showprogress)
+    std::cout << std::endl;
+
+  if (!verifyonly)
+  {
+    bool flushok = fe.flushStaging();
+    fe.setOutputFile(nullptr);
+    if (!flushok)
+    {
+      std::cout << "Error writing to '" << output << "'" << std::endl;
+      return false;
+    }
+  }
+
+  if (!endfound)
+  {
+    if (fd.badMac())
+      std::cout << "Error: corrupted frame encountered (frame " << lastframenumber + 1 << ", at offset "
+                << fd.lastFramePos() << "), the backup cannot be read beyond it" << std::endl;
+    else
+      std::cout << "Error: backup file ended before its EndFrame was found" << std::endl;
+    return false;
+  }
+
+  if (badframes)
+    std::cout << "Encountered " << badframes << " corrupted frame" << (badframes == 1 ? "" : "s") << std::endl;
+  std::cout << "Done!" << std::endl;
+  return !verifyonly || badframes == 0;
+}
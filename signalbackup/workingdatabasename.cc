@@ -0,0 +1,53 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+// the database the backup is loaded into: in memory, or (when a working directory
+// is set) a new file in that directory, which is removed again when it is closed.
+// The file holds the decrypted database, so it is created here (exclusively, readable
+// by the owner only) before SQLite opens it, never reusing an existing file.
+std::string SignalBackup::workingDatabaseName() // static
+{
+  if (s_workdbdir.empty())
+    return ":memory:";
+
+#if !defined(_WIN32) && !defined(__MINGW64__)
+  std::string name = (std::filesystem::path(s_workdbdir) / "signalbackup-tools_workdb_XXXXXX").string();
+  int fd = mkstemp(name.data()); // O_CREAT | O_EXCL, mode 0600
+  if (fd == -1)
+  {
+    int err = errno;
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : Failed to create working database in '"
+              << s_workdbdir << "': " << std::strerror(err) << std::endl;
+    return std::string(); // makes opening the database (and setupWorkingFile()) fail
+  }
+  close(fd);
+  return name;
+#else
+  static unsigned int count = 0;
+  std::string base = "signalbackup-tools_workdb_" +
+    bepaald::toString(std::chrono::system_clock::now().time_since_epoch().count()) + "_";
+  std::filesystem::path name;
+  do
+    name = std::filesystem::path(s_workdbdir) / (base + bepaald::toString(count++) + ".sqlite");
+  while (bepaald::fileOrDirExists(name));
+  return name.string();
+#endif
+}
@@ -0,0 +1,72 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+// writes the decrypted data (.bin) and the frame (.sbf) of an attachment, avatar or sticker.
+// Large attachments that are not in memory are decrypted and written in blocks, and never
+// loaded completely. The data goes to a temporary file, which only gets its final name
+// (and the .sbf is only written) once the data was written completely and its MAC checked.
+// Safe to call concurrently for different frames.
+bool SignalBackup::writeAttachmentFile(AttachmentFile const &file) const
+{
+  FrameWithAttachment *frame = file.frame;
+  std::string const datafilename = file.basefilename + ".bin";
+  std::string const tmpfilename = datafilename + ".tmp";
+
+  bool streamdata = frame->attachmentSize() > BaseDecryptor::s_attachmentblocksize && !frame->attachmentDataLoaded();
+  unsigned char *data = nullptr;
+  if (!streamdata && !(data = frame->attachmentData()))
+  {
+    std::cout << "Failed to get (valid) data for file: " << datafilename << std::endl;
+    return false;
+  }
+
+  // write actual data
+  std::ofstream datastream(tmpfilename, std::ios_base::binary);
+  if (!datastream.is_open())
+  {
+    std::cout << "Failed to open file for writing: " << tmpfilename << std::endl;
+    return false;
+  }
+
+  bool ok = false;
+  if (streamdata)
+    ok = (BaseDecryptor::getAttachmentBlocks(frame, true, [&datastream](unsigned char const *block, uint32_t size)
+                                                          { return static_cast<bool>(datastream.write(reinterpret_cast<char const *>(block), size)); }) == 0);
+  else
+    ok = static_cast<bool>(datastream.write(reinterpret_cast<char *>(data), frame->attachmentSize()));
+
+  datastream.close();
+  std::error_code ec;
+  if (ok && datastream)
+    std::filesystem::rename(tmpfilename, datafilename, ec);
+  if (!ok || !datastream || ec)
+  {
+    std::cout << "Failed to write (valid) data to file: " << datafilename << std::endl;
+    std::filesystem::remove(tmpfilename, ec);
+    return false;
+  }
+
+  if (file.dropattachmentdata)
+    frame->clearData();
+
+  // write frame
+  return writeRawFrameDataToFile(file.basefilename + ".sbf", frame);
+}
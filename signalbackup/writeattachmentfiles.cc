@@ -0,0 +1,60 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+#include <atomic>
+#include <thread>
+
+// writes all files, with at most 'maxoutstandingfiles' of them being decrypted and written at
+// the same time. Each worker takes the next file as soon as it finished its previous one, so
+// a file's data can be dropped right after it was written. On the first failure, no new files
+// are started.
+bool SignalBackup::writeAttachmentFiles(std::vector<AttachmentFile> const &files, unsigned int maxoutstandingfiles) const
+{
+  unsigned int numworkers = std::min(static_cast<uint64_t>(maxoutstandingfiles), static_cast<uint64_t>(files.size()));
+  if (numworkers <= 1)
+  {
+    for (auto const &file : files)
+      if (!writeAttachmentFile(file))
+        return false;
+    return true;
+  }
+
+  std::atomic<uint64_t> next(0);
+  std::atomic<bool> failed(false);
+  auto worker = [&]()
+  {
+    uint64_t idx;
+    while (!failed.load(std::memory_order_relaxed) &&
+           (idx = next.fetch_add(1, std::memory_order_relaxed)) < files.size())
+      if (!writeAttachmentFile(files[idx]))
+        failed = true;
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(numworkers - 1);
+  for (unsigned int i = 0; i < numworkers - 1; ++i)
+    workers.emplace_back(worker);
+  worker(); // this thread is one of the workers
+  for (auto &w : workers)
+    w.join();
+
+  return !failed;
+}
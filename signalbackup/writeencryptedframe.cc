@@ -19,47 +19,39 @@
 
 #include "signalbackup.ih"
 
-bool SignalBackup::writeEncryptedFrameWithoutAttachment(std::ofstream &outputfile, std::pair<unsigned char *, uint64_t> framedata)
+// frames are serialized into the encryptor's staging buffer (SqlStatementFrames, by far the
+// most common, directly), encrypted in place there and written to file in large blocks.
+// When the encryption pipeline is running, the frame is only handed to it, and the
+// attachment data is dropped (if requested) after the pipeline wrote it.
+// Large attachments that are not in memory are never loaded completely: they are read,
+// decrypted, re-encrypted and written in blocks (bypassing the pipeline). They are read
+// twice, once to verify them before anything is written, and once to write them, during
+// which the MAC is checked again (in case the file changed in between).
+bool SignalBackup::writeEncryptedFrame(FileEncryptor *fe, BackupFrame *frame, bool dropattachmentdata) // static
 {
-  // write frame (the non-attachmentdata part)
-  std::pair<unsigned char *, uint64_t> encryptedframe = d_fe.encryptFrame(framedata);
-  delete[] framedata.first;
-
-  if (!encryptedframe.first)
-  {
-    std::cout << "Failed to encrypt framedata" << std::endl;
-    return false;
-  }
-  bool writeok = !(outputfile.write(reinterpret_cast<char *>(encryptedframe.first), encryptedframe.second)).fail();
-
-  delete[] encryptedframe.first;
-  if (!writeok)
-    std::cout << "Failed to write encrypted frame data to file" << std::endl;
-
-  return writeok;
-}
-
-bool SignalBackup::writeEncryptedFrame(std::ofstream &outputfile, BackupFrame *frame)
-{
-  std::pair<unsigned char *, uint64_t> framedata = frame->getData();
-  if (!framedata.first)
-  {
-    std::cout << "Failed to get framedata from frame" << std::endl;
-    return false;
-  }
-
+  // get (or verify) the attachment data first, if it is corrupted, the entire frame is skipped
+  FrameWithAttachment *f = nullptr;
+  unsigned char *attachmentdata = nullptr;
   uint32_t attachmentsize = 0;
+  bool streamattachment = false;
   if ((attachmentsize = frame->attachmentSize()) > 0)
   {
-    FrameWithAttachment *f = reinterpret_cast<FrameWithAttachment *>(frame);
+    f = reinterpret_cast<FrameWithAttachment *>(frame);
 
     bool badmac = false;
+    bool ok = false;
+    if (attachmentsize > BaseDecryptor::s_attachmentblocksize && !f->attachmentDataLoaded())
+    {
+      streamattachment = true;
+      int res = BaseDecryptor::getAttachmentBlocks(f, true, nullptr);
+      badmac = (res == -1);
+      ok = (res == 0);
+    }
+    else
+      ok = (attachmentdata = f->attachmentData(&badmac)) != nullptr;
 
-    unsigned char *attachmentdata = f->attachmentData(&badmac);
-
-    if (!attachmentdata)
+    if (!ok)
     {
-      delete[] framedata.first;
       if (badmac)
       {
         std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Corrupted data encountered. Skipping frame." << std::endl;
@@ -67,32 +59,85 @@ bool SignalBackup::writeEncryptedFrame(std::ofstream &outputfile, BackupFrame *f
       }
       return false;
     }
+  }
 
-    if (!writeEncryptedFrameWithoutAttachment(outputfile, framedata))
+  if (fe->pipelineStarted() && !streamattachment)
+  {
+    std::pair<unsigned char *, uint64_t> framedata = frame->getData();
+    if (!framedata.first)
     {
-      delete[] framedata.first;
+      std::cout << "Failed to get framedata from frame" << std::endl;
       return false;
     }
+    return fe->pipelineAddFrame(framedata.first, framedata.second, attachmentdata, attachmentsize,
+                                (f && dropattachmentdata) ? std::function<void()>([f](){ f->clearData(); }) : std::function<void()>());
+  }
 
-    // write attachment data
-    std::pair<unsigned char *, uint64_t> newdata = d_fe.encryptAttachment(attachmentdata, attachmentsize);
-    //std::cout << "Writing attachment data..." << std::endl;
-    outputfile.write(reinterpret_cast<char *>(newdata.first), newdata.second);
-    delete[] newdata.first;
+  // a streamed attachment goes through the staging buffer, everything already in the
+  // pipeline must be written first
+  if (streamattachment && fe->pipelineStarted() && !fe->drainPipeline())
+    return false;
 
-    if (!outputfile.good())
+  uint64_t framesize = 0;
+  if (frame->frameType() == BackupFrame::FRAMETYPE::SQLSTATEMENT)
+  {
+    SqlStatementFrame *s = reinterpret_cast<SqlStatementFrame *>(frame);
+    framesize = s->dataSize();
+    unsigned char *buffer = fe->stagingBuffer(framesize);
+    if (!buffer)
+      return false;
+    s->putData(buffer, framesize);
+  }
+  else
+  {
+    std::pair<unsigned char *, uint64_t> framedata = frame->getData();
+    if (!framedata.first)
+    {
+      std::cout << "Failed to get framedata from frame" << std::endl;
+      return false;
+    }
+    framesize = framedata.second;
+    unsigned char *buffer = fe->stagingBuffer(framesize);
+    if (buffer)
+      std::memcpy(buffer, framedata.first, framesize);
+    delete[] framedata.first;
+    if (!buffer)
+      return false;
+  }
+
+  if (!fe->encryptStagedFrame(framesize))
+  {
+    std::cout << "Failed to encrypt framedata" << std::endl;
+    return false;
+  }
+
+  if (streamattachment)
+  {
+    int res = 1;
+    if (!fe->beginEncryptedAttachment() ||
+        (res = BaseDecryptor::getAttachmentBlocks(f, true, [fe](unsigned char const *data, uint32_t size)
+                                                          { return fe->writeEncryptedAttachmentBlock(data, size); })) != 0 ||
+        !fe->finishEncryptedAttachment())
     {
+      if (res == -1)
+        std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : Attachment data changed after it was verified" << std::endl;
       std::cout << "Failed to write encrypted attachmentdata to file" << std::endl;
-      delete[] framedata.first;
       return false;
     }
+    // the pipeline writes straight to file
+    if (fe->pipelineStarted() && !fe->flushStaging())
+      return false;
   }
-  else // not an attachmentframe, write it
-    if (!writeEncryptedFrameWithoutAttachment(outputfile, framedata))
+  else if (attachmentdata)
+  {
+    if (!fe->writeEncryptedAttachment(attachmentdata, attachmentsize))
     {
-      delete[] framedata.first;
+      std::cout << "Failed to write encrypted attachmentdata to file" << std::endl;
       return false;
     }
+    if (dropattachmentdata)
+      f->clearData();
+  }
 
   return true;
 }
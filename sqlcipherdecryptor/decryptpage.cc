@@ -0,0 +1,92 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlcipherdecryptor.ih"
+
+/*
+PAGE
+
+                                                     page_size
+ -------------------------------------------------------------------------------------------------------------------------------
+/                                                                     real_page_size                                            \
+|                                 -----------------------------------------------------------------------------------------------|
+|                                /                                                                                               |
+|                                |                                                                                               |
+|                                |     page + (real_page_size - (digest_size + page_padding) - iv_size)                          |
+|                                |                v                                                                              |
+
+[salt, 16 bytes, only first page][encrypted bytes][iv, 16 bytes][mac, padded to 16 bytes (for version < 3, 20 bytes, padded to 32]
+
+
+*/
+
+// checks the mac of one page as read from the file (rawPageSize() bytes, for the first page
+// the bytes after the salt), and decrypts it into out (also rawPageSize() bytes, zero padded).
+// A bad mac is not printed (pages may be decrypted on several threads), but set in *badmac
+bool SqlCipherDecryptor::decryptPage(uint32_t pagenumber, unsigned char *page, unsigned char *out,
+                                     CryptSession *cryptsession, unsigned char *calculatedmac, bool *badmac) const
+{
+  *badmac = false;
+
+  unsigned int iv_size = 16;
+  unsigned int page_padding = (((d_digestsize - 1) | 15) + 1) - d_digestsize;  // pad to multiple of 16 bytes ??? (maybe 32?)
+  unsigned int real_page_size = rawPageSize(pagenumber);
+
+  // these pointers all point to specific data inside 'page' (which was just read from dbfile
+  unsigned char *page_data_to_hash = page;
+  unsigned int page_data_to_hash_size = real_page_size - (d_digestsize + page_padding);
+  unsigned char *iv = page + page_data_to_hash_size - iv_size;
+  unsigned char *page_encrypted_data = page;
+  unsigned int page_encrypted_data_size = page_data_to_hash_size - iv_size;
+
+  // calculate MAC
+  if (!cryptsession->macInit() ||
+      !cryptsession->macUpdate(page_data_to_hash, page_data_to_hash_size) ||
+      !cryptsession->macUpdate(reinterpret_cast<unsigned char *>(&pagenumber), sizeof(pagenumber)) ||
+      !cryptsession->macFinal(calculatedmac))
+  {
+    std::cout << "Failed to update/finalize hmac" << std::endl;
+    return false;
+  }
+  if (std::memcmp(page + (real_page_size - (d_digestsize + page_padding)), calculatedmac, d_digestsize) != 0)
+  {
+    *badmac = true;
+    return false;
+  }
+
+  //std::cout << "MAC OK!" << std::endl;
+
+  // set iv
+  if (!cryptsession->cipherInit(iv))
+  {
+    std::cout << "CTX INIT FAILED" << std::endl;
+    return false;
+  }
+
+  //std::cout << "INIT OK!" << std::endl;
+  if (!cryptsession->cipherUpdate(out, page_encrypted_data, page_encrypted_data_size))
+  {
+    std::cout << "Failed to update decryption context" << std::endl;
+    ERR_print_errors_fp(stderr);
+    return false;
+  }
+  //std::cout << "DECRYPT OK!" << std::endl;
+  std::memset(out + page_encrypted_data_size, 0, real_page_size - page_encrypted_data_size); // append zeros
+  return true;
+}
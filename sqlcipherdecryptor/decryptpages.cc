@@ -0,0 +1,58 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlcipherdecryptor.ih"
+
+// decrypts the pages [firstpage, lastpage) into their place in d_decrypteddata, reading
+// them through its own file stream and crypto contexts (it runs on its own thread).
+// A page with a bad MAC is recorded in badpages, decryption of the slice stops there.
+bool SqlCipherDecryptor::decryptPages(uint32_t firstpage, uint32_t lastpage, CryptSession const *keyedsession,
+                                      std::vector<uint32_t> *badpages) const
+{
+  std::ifstream dbfile(d_apppath + "/sql/db.sqlite", std::ios_base::in | std::ios_base::binary);
+  if (!dbfile.is_open() || !dbfile.seekg(rawPageOffset(firstpage)))
+  {
+    std::cout << "Failed to open database file '" << d_apppath + "/sql/db.sqlite" << "'" << std::endl;
+    return false;
+  }
+
+  CryptSession cryptsession;
+  if (!cryptsession.initFrom(*keyedsession))
+    return false;
+  std::unique_ptr<unsigned char[]> page(new unsigned char[d_pagesize]);
+  std::unique_ptr<unsigned char[]> calculatedmac(new unsigned char[d_digestsize]);
+
+  for (uint32_t pagenumber = firstpage; pagenumber < lastpage; ++pagenumber)
+  {
+    if (!dbfile.read(reinterpret_cast<char *>(page.get()), rawPageSize(pagenumber)))
+    {
+      std::cout << "Unexpectedly failed to read page " << pagenumber << (dbfile.eof() ? " (EOF)" : "") << std::endl;
+      return false;
+    }
+
+    bool badmac = false;
+    if (!decryptPage(pagenumber, page.get(), d_decrypteddata + rawPageOffset(pagenumber), &cryptsession, calculatedmac.get(), &badmac))
+    {
+      if (badmac)
+        badpages->push_back(pagenumber);
+      return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,69 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlcipherdecryptor.ih"
+
+// (lazy mode) returns the decrypted page (d_pagesize bytes, the first one starting with the
+// sqlite header), decrypting it if it was not among the most recently used ones
+unsigned char const *SqlCipherDecryptor::getPage(uint32_t pagenumber)
+{
+  auto it = d_pagecacheindex.find(pagenumber);
+  if (it != d_pagecacheindex.end())
+  {
+    d_pagecache.splice(d_pagecache.begin(), d_pagecache, it->second);
+    return it->second->second.get();
+  }
+
+  // reuse the least recently used page when the cache is full
+  std::unique_ptr<unsigned char[]> decrypted;
+  if (d_pagecache.size() >= s_pagecachesize)
+  {
+    decrypted = std::move(d_pagecache.back().second);
+    d_pagecacheindex.erase(d_pagecache.back().first);
+    d_pagecache.pop_back();
+  }
+  else
+    decrypted.reset(new unsigned char[d_pagesize]);
+
+  d_dbfile.clear();
+  if (!d_dbfile.seekg(rawPageOffset(pagenumber)) ||
+      !d_dbfile.read(reinterpret_cast<char *>(d_rawpage.get()), rawPageSize(pagenumber)))
+  {
+    std::cout << "Failed to read page " << pagenumber << " from database file" << std::endl;
+    return nullptr;
+  }
+
+  unsigned char *out = decrypted.get();
+  if (pagenumber == 1)
+  {
+    std::memcpy(out, s_sqlliteheader, s_sqlliteheader_size);
+    out += s_sqlliteheader_size;
+  }
+  bool badmac = false;
+  if (!decryptPage(pagenumber, d_rawpage.get(), out, d_cryptsession.get(), d_calculatedmac.get(), &badmac))
+  {
+    if (badmac)
+      std::cout << "BAD MAC! (pagenumber: " << pagenumber << ")" << std::endl;
+    return nullptr;
+  }
+
+  d_pagecache.emplace_front(pagenumber, std::move(decrypted));
+  d_pagecacheindex.emplace(pagenumber, d_pagecache.begin());
+  return d_pagecache.front().second.get();
+}
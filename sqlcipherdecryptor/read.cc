@@ -0,0 +1,49 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlcipherdecryptor.ih"
+
+// copies size bytes of the decrypted database, starting at offset, into buffer
+bool SqlCipherDecryptor::read(unsigned char *buffer, uint64_t size, uint64_t offset)
+{
+  if (!d_lazy)
+  {
+    if (!d_decrypteddata || offset + size > d_decrypteddatasize)
+      return false;
+    std::memcpy(buffer, d_decrypteddata + offset, size);
+    return true;
+  }
+
+  while (size)
+  {
+    uint32_t pagenumber = offset / d_pagesize + 1;
+    uint64_t offsetinpage = offset % d_pagesize;
+    uint64_t toread = std::min(size, d_pagesize - offsetinpage);
+
+    unsigned char const *page = getPage(pagenumber);
+    if (!page)
+      return false;
+    std::memcpy(buffer, page + offsetinpage, toread);
+
+    buffer += toread;
+    offset += toread;
+    size -= toread;
+  }
+  return true;
+}
@@ -27,7 +27,8 @@
   - Pagesize: 1024 -> 4096
 */
 
-SqlCipherDecryptor::SqlCipherDecryptor(std::string const &configpath, std::string const &apppath, int version)
+SqlCipherDecryptor::SqlCipherDecryptor(std::string const &configpath, std::string const &apppath, int version, bool lazy,
+                                       unsigned int numthreads)
   :
   d_ok(false),
   d_configpath(configpath),
@@ -46,29 +47,30 @@ SqlCipherDecryptor::SqlCipherDecryptor(std::string const &configpath, std::strin
   d_digestsize(EVP_MD_size(d_digest)),
   d_pagesize(version >= 4 ? 4096 : 1024),
   d_decrypteddata(nullptr),
-  d_decrypteddatasize(0)
+  d_decrypteddatasize(0),
+  d_lazy(lazy)
 {
   if (!getKey())
     return;
 
-  // open database file
-  std::ifstream dbfile(d_apppath + "/sql/db.sqlite", std::ios_base::in | std::ios_base::binary);
-  if (!dbfile.is_open())
+  // open database file (in lazy mode, it stays open)
+  d_dbfile.open(d_apppath + "/sql/db.sqlite", std::ios_base::in | std::ios_base::binary);
+  if (!d_dbfile.is_open())
   {
     std::cout << "Failed to open database file '" << d_apppath + "/sql/db.sqlite" << "'" << std::endl;
     return;
   }
 
   // get file size (this will also be the output file size
-  dbfile.seekg(0, std::ios_base::end);
-  d_decrypteddatasize = dbfile.tellg();
-  dbfile.seekg(0, std::ios_base::beg);
+  d_dbfile.seekg(0, std::ios_base::end);
+  d_decrypteddatasize = d_dbfile.tellg();
+  d_dbfile.seekg(0, std::ios_base::beg);
 
   // read salt
   d_saltsize = 16;
   d_salt = new unsigned char[d_saltsize];
 
-  if (!dbfile.read(reinterpret_cast<char *>(d_salt), d_saltsize))
+  if (!d_dbfile.read(reinterpret_cast<char *>(d_salt), d_saltsize))
   {
     std::cout << "Failed to read salt from database file" << std::endl;
     return;
@@ -77,8 +79,20 @@ SqlCipherDecryptor::SqlCipherDecryptor(std::string const &configpath, std::strin
   if (!getHmacKey())
     return;
 
-  if (!decryptData(&dbfile))
-    return;
+  if (d_lazy)
+  {
+    d_cryptsession.reset(new CryptSession);
+    if (!initCryptSession(d_cryptsession.get()))
+      return;
+    d_rawpage.reset(new unsigned char[d_pagesize]);
+    d_calculatedmac.reset(new unsigned char[d_digestsize]);
+  }
+  else
+  {
+    d_dbfile.close(); // every decrypting thread opens its own
+    if (!decryptData(numthreads))
+      return;
+  }
 
   // std::cout << "CIPHER KEY: " << bepaald::bytesToHexString(d_key, d_keysize) << std::endl;
   // std::cout << "  HMAC KEY: " << bepaald::bytesToHexString(d_hmackey, d_hmackeysize) << std::endl;
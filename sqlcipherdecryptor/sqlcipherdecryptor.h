@@ -22,11 +22,16 @@
 
 #include <string>
 #include <fstream>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <vector>
 
 #include "../common_be.h"
 
 
 struct evp_md_st;
+class CryptSession;
 
 class SqlCipherDecryptor
 {
@@ -47,6 +52,17 @@ class SqlCipherDecryptor
   unsigned char *d_decrypteddata;
   uint64_t d_decrypteddatasize;
 
+  // lazy mode: nothing is decrypted up front, pages are decrypted (and their MAC checked)
+  // when read(), the most recently used ones are kept
+  bool d_lazy;
+  std::ifstream d_dbfile;
+  std::unique_ptr<CryptSession> d_cryptsession;
+  std::unique_ptr<unsigned char[]> d_rawpage;
+  std::unique_ptr<unsigned char[]> d_calculatedmac;
+  std::list<std::pair<uint32_t, std::unique_ptr<unsigned char[]>>> d_pagecache;
+  std::unordered_map<uint32_t, std::list<std::pair<uint32_t, std::unique_ptr<unsigned char[]>>>::iterator> d_pagecacheindex;
+  static unsigned int constexpr s_pagecachesize = 1024;
+
   static unsigned char constexpr s_saltmask = 0x3a;
   static int constexpr s_sqlliteheader_size = 16;
   static char constexpr s_sqlliteheader[s_sqlliteheader_size] = {'S', 'Q', 'L', 'i', 't', 'e', ' ', 'f', 'o', 'r', 'm', 'a', 't', ' ', '3', '\0'};
@@ -58,17 +74,28 @@ class SqlCipherDecryptor
   };
 
  public:
-  explicit SqlCipherDecryptor(std::string const &configpath, std::string const &apppath, int version);
+  explicit SqlCipherDecryptor(std::string const &configpath, std::string const &apppath, int version, bool lazy = false,
+                              unsigned int numthreads = 1);
   SqlCipherDecryptor(SqlCipherDecryptor const &other) = delete;
   SqlCipherDecryptor &operator=(SqlCipherDecryptor const &other) = delete;
   ~SqlCipherDecryptor();
   inline bool ok() const;
   inline DecodedData data() const;
   inline bool writeToFile(std::string const &filename, bool overwrite) const;
+  inline uint64_t size() const;
+  bool read(unsigned char *buffer, uint64_t size, uint64_t offset);
  private:
   bool getKey();
   bool getHmacKey();
-  bool decryptData(std::ifstream *dbfile);
+  bool initCryptSession(CryptSession *cryptsession) const;
+  bool decryptData(unsigned int numthreads);
+  bool decryptPages(uint32_t firstpage, uint32_t lastpage, CryptSession const *keyedsession,
+                    std::vector<uint32_t> *badpages) const;
+  bool decryptPage(uint32_t pagenumber, unsigned char *page, unsigned char *out,
+                   CryptSession *cryptsession, unsigned char *calculatedmac, bool *badmac) const;
+  unsigned char const *getPage(uint32_t pagenumber);
+  inline unsigned int rawPageSize(uint32_t pagenumber) const;
+  inline uint64_t rawPageOffset(uint32_t pagenumber) const;
 };
 
 inline bool SqlCipherDecryptor::ok() const
@@ -81,6 +108,25 @@ inline SqlCipherDecryptor::DecodedData SqlCipherDecryptor::data() const
   return {d_decrypteddata, d_decrypteddatasize};
 }
 
+// size of the (decrypted) database
+inline uint64_t SqlCipherDecryptor::size() const
+{
+  return d_decrypteddatasize;
+}
+
+// size of a page as stored in the file (the first one starts after the salt)
+inline unsigned int SqlCipherDecryptor::rawPageSize(uint32_t pagenumber) const
+{
+  return pagenumber == 1 ? d_pagesize - d_saltsize : d_pagesize;
+}
+
+// offset of a page in the file, this is also its offset in the decrypted database (where
+// the sqlite header takes the place of the salt)
+inline uint64_t SqlCipherDecryptor::rawPageOffset(uint32_t pagenumber) const
+{
+  return pagenumber == 1 ? d_saltsize : static_cast<uint64_t>(pagenumber - 1) * d_pagesize;
+}
+
 inline bool SqlCipherDecryptor::writeToFile(std::string const &filename, bool overwrite) const
 {
   if (!overwrite && bepaald::fileOrDirExists(filename))
@@ -96,7 +142,7 @@ inline bool SqlCipherDecryptor::writeToFile(std::string const &filename, bool ov
     return false;
   }
 
-  if (!out.write(reinterpret_cast<char *>(d_decrypteddata), d_decrypteddatasize))
+  if (!d_decrypteddata || !out.write(reinterpret_cast<char *>(d_decrypteddata), d_decrypteddatasize))
   {
     std::cout << "Error writing data to file" << std::endl;
     return false;
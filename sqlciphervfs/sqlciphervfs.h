@@ -0,0 +1,250 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SQLCIPHERVFS_H_
+#define SQLCIPHERVFS_H_
+
+#include <sqlite3.h>
+#include <cstdint>
+#include <iostream>
+#include <cstring>
+
+#include "../sqlcipherdecryptor/sqlcipherdecryptor.h"
+
+// Read-only vfs on an encrypted (SQLCipher) database: like MemFileDB, but instead of reading
+// from a fully decrypted copy, every read is served by the (lazy) SqlCipherDecryptor, which
+// only decrypts the pages that are actually read.
+class SqlCipherVFS
+{
+  struct CipherFile
+  {
+    sqlite3_file base; // Base class. Must be first.
+    SqlCipherDecryptor *decryptor;
+  };
+  static sqlite3_vfs s_sqlciphervfs;
+  static char constexpr s_name[] = {'S', 'q', 'l', 'C', 'i', 'p', 'h', 'e', 'r', 'V', 'F', 'S', '\0'};
+ public:
+  static sqlite3_vfs *sqlite3_sqlciphervfs(SqlCipherDecryptor *decryptor);
+  static char const *vfsName()
+  {
+    return s_name;
+  }
+ private:
+  static int ioWrite(sqlite3_file *, void const *, int, sqlite_int64);
+  static int ioClose(sqlite3_file *pFile);
+  static int ioRead(sqlite3_file *pFile, void *zBuf, int iAmt, sqlite_int64 iOfst);
+  static int ioTruncate(sqlite3_file *pFile, sqlite_int64 size);
+  static int ioSync(sqlite3_file *pFile, int flags);
+  static int ioFileSize(sqlite3_file *pFile, sqlite_int64 *pSize);
+  static int ioLock(sqlite3_file *pFile, int eLock);
+  static int ioUnlock(sqlite3_file *pFile, int eLock);
+  static int ioCheckReservedLock(sqlite3_file *pFile, int *pResOut);
+  static int ioFileControl(sqlite3_file *pFile, int op, void *pArg);
+  static int ioSectorSize(sqlite3_file *pFile);
+  static int ioDeviceCharacteristics(sqlite3_file *pFile);
+  static int open(sqlite3_vfs *pVfs, char const *zName, sqlite3_file *pFile, int flags, int *pOutFlags);
+  static int del(sqlite3_vfs *pVfs, char const *zPath, int dirSync);
+  static int access(sqlite3_vfs *pVfs, char const *zPath, int flags, int *pResOut);
+  static int fullPathname(sqlite3_vfs *pVfs, char const *zPath, int nPathOut, char *zPathOut);
+
+  static sqlite3_io_methods constexpr s_io = {1,                                        /* iVersion */
+                                              SqlCipherVFS::ioClose,                    /* xClose */
+                                              SqlCipherVFS::ioRead,                     /* xRead */
+                                              SqlCipherVFS::ioWrite,                    /* xWrite */
+                                              SqlCipherVFS::ioTruncate,                 /* xTruncate */
+                                              SqlCipherVFS::ioSync,                     /* xSync */
+                                              SqlCipherVFS::ioFileSize,                 /* xFileSize */
+                                              SqlCipherVFS::ioLock,                     /* xLock */
+                                              SqlCipherVFS::ioUnlock,                   /* xUnlock */
+                                              SqlCipherVFS::ioCheckReservedLock,        /* xCheckReservedLock */
+                                              SqlCipherVFS::ioFileControl,              /* xFileControl */
+                                              SqlCipherVFS::ioSectorSize,               /* xSectorSize */
+                                              SqlCipherVFS::ioDeviceCharacteristics,    /* xDeviceCharacteristics */
+
+                                              /* since we specified iversion == 1 above, the next fields actually
+                                                 should not exist, but just to suppress gcc warnings....  */
+
+                                              nullptr,     /* xShmMap */
+                                              nullptr,     /* xShmLock */
+                                              nullptr,     /* xShmBarrier */
+                                              nullptr,     /* xShmUnmap */
+                                              nullptr,     /* xFetch */
+                                              nullptr,     /* xUnfetch */};
+};
+
+inline int SqlCipherVFS::ioClose(sqlite3_file *pFile [[maybe_unused]])
+{
+  return SQLITE_OK;
+}
+
+inline int SqlCipherVFS::ioRead(sqlite3_file *pFile, void *zBuf, int iAmt, sqlite_int64 iOfst)
+{
+  SqlCipherDecryptor *decryptor = reinterpret_cast<CipherFile *>(pFile)->decryptor;
+  if (!decryptor || iOfst < 0)
+    return SQLITE_IOERR_READ;
+
+  // reads past the end must fill the rest with zeros
+  int toread = iAmt;
+  bool shortread = false;
+  if (static_cast<uint64_t>(iOfst) + iAmt > decryptor->size())
+  {
+    toread = static_cast<uint64_t>(iOfst) >= decryptor->size() ? 0 : decryptor->size() - iOfst;
+    std::memset(static_cast<unsigned char *>(zBuf) + toread, 0, iAmt - toread);
+    shortread = true;
+  }
+
+  if (toread && !decryptor->read(static_cast<unsigned char *>(zBuf), toread, iOfst))
+    return SQLITE_IOERR_READ;
+
+  // disable WAL (Write-Ahead Logging) on database, reading it like this otherwise will
+  // not work. See https://www.sqlite.org/fileformat.html
+  for (sqlite_int64 pos : {0x12, 0x13})
+    if (pos >= iOfst && pos < iOfst + toread && static_cast<unsigned char *>(zBuf)[pos - iOfst] == 2)
+      static_cast<unsigned char *>(zBuf)[pos - iOfst] = 1;
+
+  return shortread ? SQLITE_IOERR_SHORT_READ : SQLITE_OK;
+}
+
+inline int SqlCipherVFS::ioWrite(sqlite3_file *pFile [[maybe_unused]], void const *, int, sqlite_int64)
+{
+  return SQLITE_READONLY;
+}
+
+inline int SqlCipherVFS::ioTruncate(sqlite3_file *pFile [[maybe_unused]], sqlite_int64 size [[maybe_unused]])
+{
+  return SQLITE_IOERR_TRUNCATE;
+}
+
+inline int SqlCipherVFS::ioSync(sqlite3_file *pFile [[maybe_unused]], int flags [[maybe_unused]])
+{
+  return SQLITE_IOERR_FSYNC;
+}
+
+inline int SqlCipherVFS::ioFileSize(sqlite3_file *pFile, sqlite_int64 *pSize)
+{
+  *pSize = reinterpret_cast<CipherFile *>(pFile)->decryptor->size();
+  return SQLITE_OK;
+}
+
+inline int SqlCipherVFS::ioLock(sqlite3_file *pFile [[maybe_unused]], int eLock [[maybe_unused]])
+{
+  return SQLITE_OK;
+}
+
+inline int SqlCipherVFS::ioUnlock(sqlite3_file *pFile [[maybe_unused]], int eLock [[maybe_unused]])
+{
+  return SQLITE_OK;
+}
+
+inline int SqlCipherVFS::ioCheckReservedLock(sqlite3_file *pFile [[maybe_unused]], int *pResOut)
+{
+  *pResOut = 0;
+  return SQLITE_OK;
+}
+
+inline int SqlCipherVFS::ioFileControl(sqlite3_file *pFile [[maybe_unused]], int op [[maybe_unused]], void *pArg [[maybe_unused]])
+{
+  return SQLITE_NOTFOUND;
+}
+
+inline int SqlCipherVFS::ioSectorSize(sqlite3_file *pFile [[maybe_unused]])
+{
+  return 0;
+}
+
+inline int SqlCipherVFS::ioDeviceCharacteristics(sqlite3_file *pFile [[maybe_unused]])
+{
+  return SQLITE_IOCAP_IMMUTABLE;
+}
+
+inline int SqlCipherVFS::fullPathname(sqlite3_vfs *pVfs [[maybe_unused]], char const *zPath, int nPathOut, char *zPathOut)
+{
+  if (nPathOut >= static_cast<int>(strlen(zPath)))
+  {
+    std::strcpy(zPathOut, zPath);
+    return SQLITE_OK;
+  }
+  else
+    return SQLITE_CANTOPEN;
+}
+
+inline int SqlCipherVFS::open(sqlite3_vfs *pVfs, char const *zName [[maybe_unused]], sqlite3_file *pFile, int flags, int *pOutFlags)
+{
+  CipherFile *p = reinterpret_cast<CipherFile *>(pFile);
+  std::memset(p, 0, sizeof(CipherFile));
+  if (pOutFlags)
+    *pOutFlags = flags | SQLITE_READONLY;
+
+  p->base.pMethods = &s_io;
+  p->decryptor = reinterpret_cast<SqlCipherDecryptor *>(pVfs->pAppData);
+
+  return SQLITE_OK;
+}
+
+inline int SqlCipherVFS::del(sqlite3_vfs *pVfs [[maybe_unused]], const char *zPath [[maybe_unused]], int dirSync [[maybe_unused]])
+{
+  return SQLITE_IOERR_DELETE;
+}
+
+inline int SqlCipherVFS::access(sqlite3_vfs *pVfs, char const *zPath [[maybe_unused]], int flags [[maybe_unused]], int *pResOut)
+{
+  if (reinterpret_cast<SqlCipherDecryptor const *>(pVfs->pAppData)->size() > 0)
+  {
+    *pResOut = 0;
+    return SQLITE_OK;
+  }
+  return SQLITE_IOERR_ACCESS;
+}
+
+inline sqlite3_vfs *SqlCipherVFS::sqlite3_sqlciphervfs(SqlCipherDecryptor *decryptor)
+{
+  std::memset(&s_sqlciphervfs, 0, sizeof(s_sqlciphervfs));
+
+  s_sqlciphervfs = {1,                     /* iVersion */
+                    sizeof(CipherFile),    /* szOsFile */
+                    sizeof(s_name) + 8,    /* mxPathname (see MemFileDB) */
+                    0,                     /* pNext */
+                    vfsName(),             /* zName */
+                    decryptor,             /* pAppData */
+                    open,                  /* xOpen */
+                    del,                   /* xDelete */
+                    access,                /* xAccess */
+                    fullPathname,          /* xFullPathname */
+                    nullptr,               /* xDlOpen */
+                    nullptr,               /* xDlError */
+                    nullptr,               /* xDlSym */
+                    nullptr,               /* xDlClose */
+                    nullptr,               /* xRandomness */
+                    nullptr,               /* xSleep */
+                    nullptr,               /* xCurrentTime */
+                    nullptr,               /* xGetLastError */
+
+                    /* since we specified iversion == 1 above, the next fields actually
+                       should not exist, but just to suppress gcc warnings....  */
+
+                    nullptr,               /* xCurrentTimeInt64 */
+                    nullptr,               /* xSetSystemCall */
+                    nullptr,               /* xGetSystemCall */
+                    nullptr,               /* xNextSystemCall */
+  };
+
+  return &s_sqlciphervfs;
+}
+
+#endif
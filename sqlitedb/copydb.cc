@@ -21,6 +21,10 @@
 
 bool SqliteDB::copyDb(SqliteDB const &source, SqliteDB const &target) // static
 {
+  // copy complete data only
+  if (!source.loadDeferredTables())
+    return false;
+
   sqlite3_backup *backup = sqlite3_backup_init(target.d_db, "main", source.d_db, "main");
   if (!backup)
   {
@@ -30,6 +34,7 @@ bool SqliteDB::copyDb(SqliteDB const &source, SqliteDB const &target) // static
   int rc = 0;
   if ((rc = sqlite3_backup_step(backup, -1)) != SQLITE_DONE)
     std::cout << "SQL Error: " << sqlite3_errstr(rc) << std::endl;
+  target.invalidateSchemaCache();
   if (sqlite3_backup_finish(backup) != SQLITE_OK)
   {
     std::cout << "SQL Error: Error finishing backup" << std::endl;
@@ -0,0 +1,110 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlitedb.ih"
+
+// replaces literals in a query by '?' (lists of them by '?,...') and collapses whitespace, so
+// queries that only differ in their (pasted-in) values are counted together by the profiler
+std::string SqliteDB::normalizeQuery(char const *q) // static
+{
+  std::string result;
+  if (!q)
+    return result;
+
+  auto isidentchar = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$'; };
+  auto addparameter = [&result]()
+  {
+    // '?' or '?,...' followed by ',' (and a space): just extend the list
+    std::string::size_type pos = result.find_last_not_of(' ');
+    if (pos != std::string::npos && result[pos] == ',' && pos > 0)
+    {
+      std::string::size_type prev = result.find_last_not_of(' ', pos - 1);
+      if (prev != std::string::npos && (result[prev] == '?' || (prev >= 4 && result.compare(prev - 4, 5, "?,...") == 0)))
+      {
+        result.resize(prev + 1);
+        if (result.back() == '?')
+          result += ",...";
+        return;
+      }
+    }
+    result += '?';
+  };
+
+  for (char const *c = q; *c; ++c)
+  {
+    if (std::isspace(static_cast<unsigned char>(*c)))
+    {
+      if (!result.empty() && result.back() != ' ')
+        result += ' ';
+      continue;
+    }
+
+    bool startofword = (c == q || !isidentchar(*(c - 1)));
+
+    // string literal, or blob literal (x'...')
+    if (*c == '\'' || (startofword && (*c == 'x' || *c == 'X') && *(c + 1) == '\''))
+    {
+      if (*c != '\'')
+        ++c;
+      while (*(c + 1) && !(*(c + 1) == '\'' && *(c + 2) != '\''))
+        c += (*(c + 1) == '\'') ? 2 : 1; // skip escaped quotes ('')
+      if (*(c + 1))
+        ++c;
+      addparameter();
+      continue;
+    }
+
+    // quoted identifier, copy as is
+    if (*c == '"' || *c == '`' || *c == '[')
+    {
+      char close = (*c == '[') ? ']' : *c;
+      result += *c;
+      while (*(c + 1) && *(c + 1) != close)
+        result += *(++c);
+      if (*(c + 1))
+        result += *(++c);
+      continue;
+    }
+
+    // numeric literal (including hex and reals)
+    if (startofword && (std::isdigit(static_cast<unsigned char>(*c)) || (*c == '.' && std::isdigit(static_cast<unsigned char>(*(c + 1))))))
+    {
+      while (*(c + 1) && (isidentchar(*(c + 1)) || *(c + 1) == '.' ||
+                          ((*(c + 1) == '+' || *(c + 1) == '-') && (*c == 'e' || *c == 'E'))))
+        ++c;
+      addparameter();
+      continue;
+    }
+
+    // bound parameter
+    if (*c == '?')
+    {
+      while (std::isdigit(static_cast<unsigned char>(*(c + 1))))
+        ++c;
+      addparameter();
+      continue;
+    }
+
+    result += *c;
+  }
+
+  if (!result.empty() && result.back() == ' ')
+    result.pop_back();
+  return result;
+}
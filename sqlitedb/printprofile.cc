@@ -0,0 +1,60 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlitedb.ih"
+
+// prints the topn queries that took the most time in total (see setProfiling())
+void SqliteDB::printProfile(unsigned int topn) // static
+{
+  std::lock_guard<std::mutex> lock(s_profilemutex);
+
+  std::vector<std::pair<std::string const, QueryProfile> const *> sorted;
+  uint64_t totalns = 0;
+  uint64_t totalcalls = 0;
+  for (auto const &p : s_profile)
+  {
+    sorted.push_back(&p);
+    totalns += p.second.totalns;
+    totalcalls += p.second.calls;
+  }
+  std::sort(sorted.begin(), sorted.end(), [](auto const *a, auto const *b) { return a->second.totalns > b->second.totalns; });
+  if (sorted.size() > topn)
+    sorted.resize(topn);
+
+  std::cout << std::endl << "SQL profile: " << s_profile.size() << " distinct queries, " << totalcalls << " executions, "
+            << std::fixed << std::setprecision(3) << totalns / 1e9 << "s" << std::endl;
+  if (sorted.empty())
+    return;
+
+  std::cout << "Top " << sorted.size() << " by total time:" << std::endl
+            << std::setw(4) << "#" << " " << std::setw(10) << "total(ms)" << " " << std::setw(9) << "max(ms)" << " "
+            << std::setw(9) << "calls" << " " << std::setw(10) << "rows" << " " << std::setw(12) << "vm steps" << " "
+            << std::setw(12) << "scan steps" << " " << std::setw(6) << "sorts" << "  query" << std::endl;
+  for (uint i = 0; i < sorted.size(); ++i)
+  {
+    QueryProfile const &qp = sorted[i]->second;
+    std::string query(sorted[i]->first);
+    if (query.size() > 200)
+      query = query.substr(0, 197) + "...";
+    std::cout << std::setw(4) << i + 1 << " " << std::setw(10) << qp.totalns / 1e6 << " " << std::setw(9) << qp.maxns / 1e6 << " "
+              << std::setw(9) << qp.calls << " " << std::setw(10) << qp.rows << " " << std::setw(12) << qp.vmsteps << " "
+              << std::setw(12) << qp.fullscansteps << " " << std::setw(6) << qp.sorts << "  " << query << std::endl;
+  }
+  std::cout << std::defaultfloat;
+}
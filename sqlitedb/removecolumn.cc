@@ -21,15 +21,15 @@
 
 bool SqliteDB::QueryResults::removeColumn(uint idx)
 {
-  if (idx >= d_headers.size())
+  if (idx >= d_headers.size() || idx >= d_columns.size())
     return false;
-  for (auto const &v : d_values)
-    if (idx >= v.size())
-      return false;
 
   d_headers.erase(d_headers.begin() + idx);
-  for (auto &v : d_values)
-    v.erase(v.begin() + idx);
+  d_columns.erase(d_columns.begin() + idx);
+
+  d_headerindex.clear();
+  for (uint i = 0; i < d_headers.size(); ++i)
+    d_headerindex.emplace(d_headers[i], i);
 
   return true;
 }
@@ -25,31 +25,77 @@
 #include <vector>
 #include <iostream>
 #include <any>
+#include <set>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <mutex>
+#include <chrono>
+#include <functional>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
 #if __cpp_lib_ranges >= 201911L && !defined(__clang__) // ranges does not currently seem to work with clang
 #include <ranges>
 #endif
 
 #include "../common_be.h"
 #include "../memfiledb/memfiledb.h"
+#include "../sqlciphervfs/sqlciphervfs.h"
 
 class SqliteDB
 {
  public:
   class QueryResults
   {
+   public:
+    enum class ValueType : unsigned char
+    {
+      NULLVALUE,
+      INTEGER,
+      FLOAT,
+      TEXT,
+      BLOB
+    };
+
+   private:
+    // one value. TEXT and BLOB data is stored in d_arena at [offset, offset + size)
+    struct Cell
+    {
+      union
+      {
+        long long int intvalue;
+        double doublevalue;
+        uint64_t offset;
+      };
+      uint32_t size;
+      ValueType type;
+    };
+
     std::vector<std::string> d_headers;
-    std::vector<std::vector<std::any>> d_values;
+    std::unordered_map<std::string, int> d_headerindex; // name -> first column with that name
+    std::vector<std::vector<Cell>> d_columns;
+    std::string d_arena;
+    size_t d_rows = 0;
+    size_t d_nextcolumn = 0;
 
    public:
     inline void emplaceHeader(std::string &&h);
     inline std::vector<std::string> const &headers() const;
     inline std::string const &header(size_t idx) const;
-    inline void emplaceValue(size_t row, std::any &&a);
+    inline void emplaceValue(size_t row, long long int value);
+    inline void emplaceValue(size_t row, double value);
+    inline void emplaceValue(size_t row, std::string_view value);
+    inline void emplaceValue(size_t row, std::nullptr_t);
+    inline void emplaceValue(size_t row, unsigned char const *blob, size_t size);
     inline std::any value(size_t row, std::string const &header) const;
     template <typename T>
     inline T getValueAs(size_t row, std::string const &header) const;
-    inline std::any const &value(size_t row, size_t idx) const;
-    inline std::vector<std::any> const &row(size_t row) const;
+    inline std::any value(size_t row, size_t idx) const;
+    inline std::vector<std::any> row(size_t row) const;
+    inline ValueType valueType(size_t row, size_t idx) const;
+    inline std::string_view textView(size_t row, size_t idx) const;
+    inline std::pair<unsigned char const *, size_t> blobView(size_t row, size_t idx) const;
     template <typename T>
     inline bool valueHasType(size_t row, size_t idx) const;
     template <typename T>
@@ -62,6 +108,7 @@ class SqliteDB
     inline size_t rows() const;
     inline size_t columns() const;
     inline void clear();
+    inline void clearRows();
     void printLineMode() const;
     void prettyPrint() const;
     void print(bool printheader = true) const;
@@ -80,6 +127,8 @@ class SqliteDB
    private:
     //std::wstring wideString(std::string const &narrow) const;
     inline int idxOfHeader(std::string const &header) const;
+    inline Cell &newCell(size_t row);
+    inline void appendCell(size_t row, Cell const &cell, QueryResults const &source);
     //bool supportsAnsi() const;
     //bool isTerminal() const;
     inline bool useEscapeCodes() const;
@@ -87,14 +136,136 @@ class SqliteDB
     inline uint64_t charCount(std::string const &utf8) const;
   };
 
+  // steps through the results of a query one row at a time, so they never all
+  // need to be in memory. The current row is row 0 of row()
+  class Cursor
+  {
+    SqliteDB const *d_db;
+    sqlite3_stmt *d_stmt;
+    std::string d_query;
+    QueryResults d_row;
+    bool d_ok;
+
+   public:
+    inline Cursor(SqliteDB const *db, std::string const &q, sqlite3_stmt *stmt);
+    Cursor(Cursor const &other) = delete;
+    Cursor &operator=(Cursor const &other) = delete;
+    inline Cursor(Cursor &&other);
+    inline ~Cursor();
+    inline bool step();
+    inline QueryResults const &row() const;
+    inline bool ok() const;
+  };
+
+  // a serialized copy of a database, taken with snapshot(). Any number of read-only
+  // SqliteDB's can be opened on it (eg one per thread), they all read this same memory
+  // without copying it, so it must outlive all of them.
+  class Snapshot
+  {
+    friend class SqliteDB;
+
+    unsigned char *d_data;
+    sqlite3_int64 d_size;
+
+   public:
+    inline explicit Snapshot(unsigned char *data = nullptr, sqlite3_int64 size = 0);
+    Snapshot(Snapshot const &other) = delete;
+    Snapshot &operator=(Snapshot const &other) = delete;
+    inline Snapshot(Snapshot &&other);
+    inline ~Snapshot();
+    inline bool ok() const;
+  };
+
+  // inserts rows into one table, keeping the statement prepared (from the first insert on,
+  // an unused inserter costs nothing). If no transaction is active when a row is inserted,
+  // it starts one and commits it every batchsize rows (and when the inserter is committed
+  // or destroyed), any other inserts in the meantime are part of it. Inside an already
+  // active transaction the rows just become part of that.
+  class Inserter
+  {
+    SqliteDB const *d_db;
+    sqlite3_stmt *d_stmt;
+    std::string d_query;
+    QueryResults d_returned;
+    unsigned int d_batchsize;
+    unsigned int d_inbatch;
+    bool d_owntransaction;
+
+   public:
+    inline Inserter(SqliteDB const *db, std::string const &q, unsigned int batchsize);
+    Inserter(Inserter const &other) = delete;
+    Inserter &operator=(Inserter const &other) = delete;
+    inline Inserter(Inserter &&other);
+    inline ~Inserter();
+    template <typename... Values>
+    inline bool insert(Values const &... values);
+    inline bool insert(std::vector<std::any> const &values);
+    inline long long int lastInsertRowid() const;
+    inline QueryResults const &returned() const;
+    inline bool commit();
+   private:
+    inline bool prepare();
+    inline bool step();
+  };
+
  private:
   sqlite3 *d_db;
   sqlite3_vfs *d_vfs;
   bool d_ok;
+  std::string d_removeonclose; // file of a working database, deleted after closing
+
+  // data that was not (yet) loaded. The first statement that reads one of the tables,
+  // that modifies any table, or (if datapragmas) runs a pragma that reads table contents,
+  // calls the loader before it runs. Loads are done in order, needing one needs all earlier ones.
+  struct DeferredLoad
+  {
+    std::set<std::string> tables;
+    bool datapragmas;
+    std::function<bool()> loader;
+  };
+  std::vector<DeferredLoad> d_deferredloads;
+  mutable int d_deferredneeded; // index of last needed load, -1 if none
+  mutable bool d_loadingdeferred;
+
+  // writes by triggers into these tables are silently skipped
+  std::set<std::string> d_ignoredtriggerwrites;
+
+  // prepared statements, most recently used first, reused when the same query is executed again
+  mutable std::list<std::pair<std::string, sqlite3_stmt *>> d_statementcache;
+  mutable std::unordered_map<std::string, std::list<std::pair<std::string, sqlite3_stmt *>>::iterator> d_statementcacheindex;
+  mutable uint64_t d_statementcachehits;
+  mutable uint64_t d_statementcachemisses;
+  static unsigned int constexpr s_statementcachesize = 64;
+
+  // results of containsTable() and tableContainsColumn(). Statements that may change the schema
+  // set d_schemacheck, the cache is then only dropped if PRAGMA schema_version actually changed
+  mutable std::unordered_map<std::string, bool> d_tablecache;
+  mutable std::unordered_map<std::string, std::unordered_set<std::string>> d_columncache;
+  mutable long long int d_schemaversion;
+  mutable bool d_schemacheck;
+
+  // per-query statistics (opt-in), gathered over all databases. Queries are grouped by
+  // their text with literals replaced by '?'
+  struct QueryProfile
+  {
+    uint64_t calls;
+    uint64_t rows;
+    uint64_t vmsteps;
+    uint64_t fullscansteps;
+    uint64_t sorts;
+    uint64_t totalns;
+    uint64_t maxns;
+  };
+  inline static bool s_profiling = false;
+  inline static std::mutex s_profilemutex;
+  inline static std::unordered_map<std::string, QueryProfile> s_profile;
+  mutable std::unordered_map<sqlite3_stmt *, std::pair<uint64_t, std::chrono::steady_clock::time_point>> d_profilerunning; // rows, start
 
  public:
   inline explicit SqliteDB(std::string const &name, bool readonly = true);
   inline explicit SqliteDB(std::pair<unsigned char *, uint64_t> *data);
+  inline explicit SqliteDB(SqlCipherDecryptor *decryptor);
+  inline explicit SqliteDB(Snapshot const &snapshot);
   inline SqliteDB(SqliteDB const &other) = delete;
   inline SqliteDB &operator=(SqliteDB const &other) = delete;
   inline ~SqliteDB();
@@ -106,6 +277,9 @@ class SqliteDB
   inline bool exec(std::string const &q, R &&params, QueryResults *results = nullptr) const;
 #endif
   inline bool exec(std::string const &q, std::vector<std::any> const &params, QueryResults *results = nullptr) const;
+  template <typename Binder>
+  inline bool execWithBinder(std::string const &q, Binder const &bindparameters, QueryResults *results = nullptr) const;
+  inline Cursor query(std::string const &q, std::vector<std::any> const &params = std::vector<std::any>()) const;
   template <typename T>
   inline T getSingleResultAs(std::string const &q, T defaultval) const;
   template <typename T>
@@ -129,6 +303,22 @@ class SqliteDB
   template <typename... columnnames>
   inline bool tableContainsColumn(std::string const &tablename, std::string const &columnname, columnnames... list) const;
   inline void freeMemory();
+  inline void addDeferredLoad(std::set<std::string> const &tables, bool datapragmas, std::function<bool()> const &loader);
+  inline bool loadDeferredTables(int upto = -1) const;
+  inline void setIgnoredTriggerWrites(std::set<std::string> const &tables);
+  inline uint64_t statementCacheHits() const;
+  inline uint64_t statementCacheMisses() const;
+  inline void printStatementCacheStats() const;
+  inline bool setupWorkingFile();
+  inline Snapshot snapshot() const;
+  inline Inserter inserter(std::string const &table, std::vector<std::string> const &columns,
+                           std::string const &returnfield = std::string(), unsigned int batchsize = 1000) const;
+  inline bool beginSavepoint(std::string const &name) const;
+  inline bool rollbackSavepoint(std::string const &name) const;
+  inline bool releaseSavepoint(std::string const &name) const;
+  inline static void setProfiling(bool profile);
+  static void printProfile(unsigned int topn);
+  static bool writeProfileJson(std::string const &filename);
 
  private:
   inline int execParamFiller(sqlite3_stmt *stmt, int count, std::string const &param) const;
@@ -144,16 +334,36 @@ class SqliteDB
   template <typename T>
   inline bool isType(std::any const &a) const;
 
+  inline sqlite3_stmt *prepareStatement(std::string const &q) const;
+  template <typename R>
+  inline bool bindParameters(sqlite3_stmt *stmt, std::string const &q, R const &params) const;
+  inline bool stepStatement(sqlite3_stmt *stmt, std::string const &q, QueryResults *results) const;
+  inline static void fillRow(sqlite3_stmt *stmt, QueryResults *results, int row);
+  inline sqlite3_stmt *takeCachedStatement(std::string const &q) const;
+  inline void cacheStatement(std::string const &q, sqlite3_stmt *stmt) const;
+  inline void clearStatementCache() const;
+  inline void checkSchemaCache() const;
+  inline void invalidateSchemaCache() const;
   inline bool registerCustoms() const;
   static inline void tokencount(sqlite3_context *context, int argc, sqlite3_value **argv);
   static inline void token(sqlite3_context *context, int argc, sqlite3_value **argv);
+  static inline int profileCallback(unsigned int type, void *userdata, void *p, void *x);
+  static std::string normalizeQuery(char const *q);
+  inline void updateAuthorizer() const;
+  static inline int deferredAuthorizer(void *userdata, int action, char const *arg1, char const *arg2, char const *arg3, char const *arg4);
 };
 
 inline SqliteDB::SqliteDB(std::string const &name, bool readonly)
   :
   d_db(nullptr),
   d_vfs(nullptr),
-  d_ok(false)
+  d_ok(false),
+  d_deferredneeded(-1),
+  d_loadingdeferred(false),
+  d_statementcachehits(0),
+  d_statementcachemisses(0),
+  d_schemaversion(-1),
+  d_schemacheck(true)
 {
   if (name != ":memory:" && readonly)
     d_ok = (sqlite3_open_v2(name.c_str(), &d_db, SQLITE_OPEN_READONLY, nullptr) == SQLITE_OK);
@@ -168,7 +378,13 @@ inline SqliteDB::SqliteDB(std::pair<unsigned char *, uint64_t> *data)
   :
   d_db(nullptr),
   d_vfs(MemFileDB::sqlite3_memfilevfs(data)),
-  d_ok(false)
+  d_ok(false),
+  d_deferredneeded(-1),
+  d_loadingdeferred(false),
+  d_statementcachehits(0),
+  d_statementcachemisses(0),
+  d_schemaversion(-1),
+  d_schemacheck(true)
 {
   if (sqlite3_vfs_register(d_vfs, 0) == SQLITE_OK)
     d_ok = (sqlite3_open_v2(MemFileDB::vfsName(), &d_db, SQLITE_OPEN_READONLY, MemFileDB::vfsName()) == SQLITE_OK);
@@ -177,46 +393,591 @@ inline SqliteDB::SqliteDB(std::pair<unsigned char *, uint64_t> *data)
     d_ok = registerCustoms();
 }
 
+// opens an encrypted Desktop database read-only, the (lazy) decryptor only decrypts the
+// pages that are read. It must outlive this object.
+inline SqliteDB::SqliteDB(SqlCipherDecryptor *decryptor)
+  :
+  d_db(nullptr),
+  d_vfs(SqlCipherVFS::sqlite3_sqlciphervfs(decryptor)),
+  d_ok(false),
+  d_deferredneeded(-1),
+  d_loadingdeferred(false),
+  d_statementcachehits(0),
+  d_statementcachemisses(0),
+  d_schemaversion(-1),
+  d_schemacheck(true)
+{
+  if (sqlite3_vfs_register(d_vfs, 0) == SQLITE_OK)
+    d_ok = (sqlite3_open_v2(SqlCipherVFS::vfsName(), &d_db, SQLITE_OPEN_READONLY, SqlCipherVFS::vfsName()) == SQLITE_OK);
+
+  if (d_ok)
+    d_ok = registerCustoms();
+}
+
+// opens a read-only connection on a snapshot(). It has its own statement cache and may be
+// used on a different thread than the database the snapshot was taken from, or than other
+// connections on the same snapshot.
+inline SqliteDB::SqliteDB(Snapshot const &snapshot)
+  :
+  d_db(nullptr),
+  d_vfs(nullptr),
+  d_ok(false),
+  d_deferredneeded(-1),
+  d_loadingdeferred(false),
+  d_statementcachehits(0),
+  d_statementcachemisses(0),
+  d_schemaversion(-1),
+  d_schemacheck(true)
+{
+  if (snapshot.ok() &&
+      sqlite3_open_v2(":memory:", &d_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX, nullptr) == SQLITE_OK)
+    // not SQLITE_DESERIALIZE_FREEONCLOSE: the data is owned by the snapshot, shared with other readers
+    d_ok = (sqlite3_deserialize(d_db, "main", snapshot.d_data, snapshot.d_size, snapshot.d_size, SQLITE_DESERIALIZE_READONLY) == SQLITE_OK);
+
+  if (d_ok)
+    d_ok = registerCustoms();
+}
+
 inline SqliteDB::~SqliteDB()
 {
+  clearStatementCache();
+
   if (d_db)
     sqlite3_close(d_db);
 
   if (d_vfs)
     sqlite3_vfs_unregister(d_vfs);
+
+  if (!d_removeonclose.empty())
+  {
+    std::error_code ec;
+    std::filesystem::remove(d_removeonclose, ec);
+  }
 }
 
-inline bool SqliteDB::ok() const
+// prepares a newly created, file-backed database to be used instead of ":memory:" as
+// scratch space: nothing needs to survive a crash, so it is neither synced nor kept after
+// closing. The journal stays (in memory, like for ":memory:") so ROLLBACK keeps working.
+// Large sorts (creating indexes) go to temporary files instead of RAM. Fails for a
+// database without a file name (SQLite's private temporary database).
+inline bool SqliteDB::setupWorkingFile()
 {
-  return d_ok;
+  char const *filename = d_db ? sqlite3_db_filename(d_db, "main") : nullptr;
+  if (!filename || filename[0] == '\0')
+    return false;
+  d_removeonclose = filename;
+
+  if (!d_ok)
+    return false;
+
+  return exec("PRAGMA page_size = 4096") && // as used by Signal's own database
+    exec("PRAGMA journal_mode = MEMORY") &&
+    exec("PRAGMA synchronous = OFF") &&
+    exec("PRAGMA locking_mode = EXCLUSIVE") &&
+    exec("PRAGMA cache_size = -262144") && // 256MiB
+    exec("PRAGMA mmap_size = 1073741824") &&
+    exec("PRAGMA temp_store = FILE");
 }
 
-inline bool SqliteDB::exec(std::string const &q, QueryResults *results) const
+// starts a (possibly nested) savepoint, changes made after it can be undone with
+// rollbackSavepoint() without needing a copy of the database. Deferred tables are loaded
+// first, a load inside the savepoint would otherwise be undone with it. Note a plain
+// BEGIN TRANSACTION fails while a savepoint is active, use nested savepoints instead.
+inline bool SqliteDB::beginSavepoint(std::string const &name) const
 {
-  return exec(q, std::vector<std::any>(), results);
+  return loadDeferredTables() && exec("SAVEPOINT " + name);
 }
 
-inline bool SqliteDB::exec(std::string const &q, std::any const &param, QueryResults *results) const
+// undoes all changes (including schema changes) since beginSavepoint(name) and ends it
+inline bool SqliteDB::rollbackSavepoint(std::string const &name) const
 {
-  return exec(q, std::vector<std::any>{param}, results);
+  return exec("ROLLBACK TO " + name) && exec("RELEASE " + name);
 }
 
-#if __cpp_lib_ranges >= 201911L && !defined(__clang__)
-template <typename R> requires std::ranges::input_range<R> && std::is_same<std::any, std::ranges::range_value_t<R>>::value
-inline bool SqliteDB::exec(std::string const &q, R &&params, QueryResults *results) const
-#else
-inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &params, QueryResults *results) const
-#endif
+// ends the savepoint, keeping its changes
+inline bool SqliteDB::releaseSavepoint(std::string const &name) const
+{
+  return exec("RELEASE " + name);
+}
+
+// serializes the current state of the database (including uncommitted changes made through
+// this connection) into one block of memory. Only for in-memory databases: a file-backed
+// (working) database is usually too large to copy into RAM, so an empty (not ok())
+// snapshot is returned, and callers should fall back to using the database itself.
+inline SqliteDB::Snapshot SqliteDB::snapshot() const
+{
+  char const *filename = sqlite3_db_filename(d_db, "main");
+  if ((filename && filename[0] != '\0') || !loadDeferredTables())
+    return Snapshot();
+
+  sqlite3_int64 size = 0;
+  unsigned char *data = sqlite3_serialize(d_db, "main", &size, 0);
+  if (!data)
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : Failed to serialize database" << std::endl;
+  return Snapshot(data, size);
+}
+
+inline void SqliteDB::addDeferredLoad(std::set<std::string> const &tables, bool datapragmas, std::function<bool()> const &loader)
+{
+  d_deferredloads.emplace_back(DeferredLoad{tables, datapragmas, loader});
+  updateAuthorizer();
+}
+
+inline bool SqliteDB::loadDeferredTables(int upto) const
+{
+  d_deferredneeded = -1;
+  if (d_deferredloads.empty())
+    return true;
+  if (upto < 0 || upto >= static_cast<int>(d_deferredloads.size()))
+    upto = static_cast<int>(d_deferredloads.size()) - 1;
+
+  // take the loads out first, the loaders themselves use this database
+  std::vector<DeferredLoad> loads(std::make_move_iterator(d_deferredloads.begin()),
+                                  std::make_move_iterator(d_deferredloads.begin() + upto + 1));
+  SqliteDB *self = const_cast<SqliteDB *>(this);
+  self->d_deferredloads.erase(self->d_deferredloads.begin(), self->d_deferredloads.begin() + upto + 1);
+
+  d_loadingdeferred = true;
+  bool ret = true;
+  for (auto const &l : loads)
+    if (ret && l.loader)
+      ret = l.loader();
+  d_loadingdeferred = false;
+
+  updateAuthorizer();
+  return ret;
+}
+
+inline void SqliteDB::setIgnoredTriggerWrites(std::set<std::string> const &tables)
+{
+  d_ignoredtriggerwrites = tables;
+  updateAuthorizer();
+}
+
+inline void SqliteDB::updateAuthorizer() const
+{
+  // cached statements were prepared (and authorized) for the previous state
+  clearStatementCache();
+  d_deferredneeded = -1;
+  if (d_deferredloads.empty() && d_ignoredtriggerwrites.empty())
+    sqlite3_set_authorizer(d_db, nullptr, nullptr);
+  else
+    sqlite3_set_authorizer(d_db, &SqliteDB::deferredAuthorizer, const_cast<SqliteDB *>(this));
+}
+
+// only called while preparing statements, must not touch the database itself. Anything
+// other than plain reads of loaded tables (and schema-only pragmas) needs the full data
+inline int SqliteDB::deferredAuthorizer(void *userdata, int action, char const *arg1, char const *, char const *, char const *trigger) // static
+{
+  auto schemaonlypragma = [](std::string name)
+  {
+    name = bepaald::toLower(name);
+    if (name.starts_with("pragma_"))
+      name.erase(0, STRLEN("pragma_"));
+    return name == "table_info" || name == "table_xinfo" || name == "table_list" || name == "index_list" ||
+      name == "index_info" || name == "index_xinfo" || name == "foreign_key_list" || name == "user_version" ||
+      name == "schema_version";
+  };
+
+  SqliteDB const *db = reinterpret_cast<SqliteDB const *>(userdata);
+
+  if ((action == SQLITE_INSERT || action == SQLITE_UPDATE || action == SQLITE_DELETE) &&
+      trigger && arg1 && db->d_ignoredtriggerwrites.find(arg1) != db->d_ignoredtriggerwrites.end())
+    return SQLITE_IGNORE;
+
+  if (db->d_loadingdeferred || db->d_deferredloads.empty())
+    return SQLITE_OK;
+
+  int all = static_cast<int>(db->d_deferredloads.size()) - 1;
+  auto needs = [db](int idx) { db->d_deferredneeded = std::max(db->d_deferredneeded, idx); };
+  auto lastwith = [db](auto const &pred)
+  {
+    for (int i = static_cast<int>(db->d_deferredloads.size()) - 1; i >= 0; --i)
+      if (pred(db->d_deferredloads[i]))
+        return i;
+    return -1;
+  };
+
+  switch (action)
+  {
+    case SQLITE_SELECT:
+    case SQLITE_FUNCTION:
+    case SQLITE_RECURSIVE:
+    case SQLITE_TRANSACTION:
+    case SQLITE_SAVEPOINT:
+      break;
+    case SQLITE_INSERT: // sqlite itself reports these on its schema table when preparing some statements,
+    case SQLITE_UPDATE: // actual schema changes are reported separately (SQLITE_CREATE_TABLE, ...)
+    case SQLITE_DELETE:
+      if (!arg1 || (std::strcmp(arg1, "sqlite_master") != 0 && std::strcmp(arg1, "sqlite_temp_master") != 0))
+        needs(all);
+      break;
+    case SQLITE_READ:
+      if (!arg1)
+        break;
+      if (std::strlen(arg1) > STRLEN("pragma_") && (arg1[0] == 'p' || arg1[0] == 'P') &&
+          bepaald::toLower(std::string(arg1, STRLEN("pragma_"))) == "pragma_")
+      {
+        if (!schemaonlypragma(arg1))
+          needs(lastwith([](DeferredLoad const &l) { return l.datapragmas; }));
+      }
+      else
+        needs(lastwith([arg1](DeferredLoad const &l) { return l.tables.find(arg1) != l.tables.end(); }));
+      break;
+    case SQLITE_PRAGMA:
+      if (!arg1 || !schemaonlypragma(arg1))
+        needs(lastwith([](DeferredLoad const &l) { return l.datapragmas; }));
+      break;
+    default:
+      needs(all);
+      break;
+  }
+  return SQLITE_OK;
+}
+
+inline sqlite3_stmt *SqliteDB::prepareStatement(std::string const &q) const
 {
-  sqlite3_stmt *stmt;
-  if (sqlite3_prepare_v2(d_db, q.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
+  // a cached statement is taken out of the cache while in use, exec() may be reentered
+  sqlite3_stmt *stmt = takeCachedStatement(q);
+  if (!stmt && sqlite3_prepare_v2(d_db, q.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
   {
     std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
       "During sqlite3_prepare_v2(): " << sqlite3_errmsg(d_db) << std::endl <<
       "  Query: \"" << q << "\"" << std::endl;
+    return nullptr;
+  }
+
+  if (d_deferredneeded >= 0) [[unlikely]] // statement needs data that was not loaded yet
+  {
+    sqlite3_finalize(stmt);
+    if (!loadDeferredTables(d_deferredneeded) ||
+        sqlite3_prepare_v2(d_db, q.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
+        "During sqlite3_prepare_v2(): " << sqlite3_errmsg(d_db) << std::endl <<
+        "  Query: \"" << q << "\"" << std::endl;
+      return nullptr;
+    }
+  }
+
+  // DDL is never read-only, ROLLBACK (TO) is, but may undo it
+  if (!sqlite3_stmt_readonly(stmt) || (q.size() >= static_cast<std::string::size_type>(STRLEN("ROLLBACK")) && bepaald::toLower(q.substr(0, STRLEN("ROLLBACK"))) == "rollback"))
+    d_schemacheck = true;
+
+  return stmt;
+}
+
+inline bool SqliteDB::stepStatement(sqlite3_stmt *stmt, std::string const &q, QueryResults *results) const
+{
+  if (results)
+    results->clear();
+  int rc;
+  int row = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+  {
+    if (!results)
+      continue;
+
+    fillRow(stmt, results, row);
+    ++row;
+  }
+  if (rc != SQLITE_DONE)
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
+      "After sqlite3_step(): " << sqlite3_errmsg(d_db) << std::endl <<
+      "  Query: \"" << q << "\"" << std::endl;
+    sqlite3_finalize(stmt);
+    return false;
+  }
+
+  cacheStatement(q, stmt);
+  return true;
+}
+
+inline void SqliteDB::fillRow(sqlite3_stmt *stmt, QueryResults *results, int row) // static
+{
+  // if headers aren't set, set them
+  if (results->columns() == 0)
+    for (int c = 0; c < sqlite3_column_count(stmt); ++c)
+      results->emplaceHeader(sqlite3_column_name(stmt, c));
+
+  // set values
+  for (int c = 0; c < sqlite3_column_count(stmt); ++c)
+  {
+    if (sqlite3_column_type(stmt, c) == SQLITE_INTEGER)
+      results->emplaceValue(row, sqlite3_column_int64(stmt, c));
+    else if (sqlite3_column_type(stmt, c) == SQLITE_FLOAT)
+      results->emplaceValue(row, sqlite3_column_double(stmt, c));
+    else if (sqlite3_column_type(stmt, c) == SQLITE_TEXT)
+      results->emplaceValue(row, std::string_view(reinterpret_cast<char const *>(sqlite3_column_text(stmt, c))));
+    else if (sqlite3_column_type(stmt, c) == SQLITE_NULL)
+      results->emplaceValue(row, nullptr);
+    else if (sqlite3_column_type(stmt, c) == SQLITE_BLOB)
+      results->emplaceValue(row, reinterpret_cast<unsigned char const *>(sqlite3_column_blob(stmt, c)), sqlite3_column_bytes(stmt, c));
+  }
+}
+
+inline SqliteDB::Cursor SqliteDB::query(std::string const &q, std::vector<std::any> const &params) const
+{
+  sqlite3_stmt *stmt = prepareStatement(q);
+  if (stmt && !bindParameters(stmt, q, params)) [[unlikely]]
+  {
+    sqlite3_finalize(stmt);
+    stmt = nullptr;
+  }
+  return Cursor(this, q, stmt);
+}
+
+inline SqliteDB::Cursor::Cursor(SqliteDB const *db, std::string const &q, sqlite3_stmt *stmt)
+  :
+  d_db(db),
+  d_stmt(stmt),
+  d_query(q),
+  d_ok(stmt != nullptr)
+{}
+
+inline SqliteDB::Cursor::Cursor(Cursor &&other)
+  :
+  d_db(other.d_db),
+  d_stmt(other.d_stmt),
+  d_query(std::move(other.d_query)),
+  d_row(std::move(other.d_row)),
+  d_ok(other.d_ok)
+{
+  other.d_stmt = nullptr;
+}
+
+inline SqliteDB::Cursor::~Cursor()
+{
+  if (d_stmt) // not stepped to the end
+    d_db->cacheStatement(d_query, d_stmt);
+}
+
+// fetches the next row, returns false when there are no more rows (or on error, see ok())
+inline bool SqliteDB::Cursor::step()
+{
+  if (!d_stmt)
+    return false;
+
+  int rc = sqlite3_step(d_stmt);
+  if (rc == SQLITE_ROW) [[likely]]
+  {
+    d_row.clearRows();
+    fillRow(d_stmt, &d_row, 0);
+    return true;
+  }
+
+  if (rc != SQLITE_DONE)
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
+      "After sqlite3_step(): " << sqlite3_errmsg(d_db->d_db) << std::endl <<
+      "  Query: \"" << d_query << "\"" << std::endl;
+    sqlite3_finalize(d_stmt);
+    d_ok = false;
+  }
+  else
+    d_db->cacheStatement(d_query, d_stmt);
+  d_stmt = nullptr;
+  return false;
+}
+
+inline SqliteDB::QueryResults const &SqliteDB::Cursor::row() const
+{
+  return d_row;
+}
+
+inline bool SqliteDB::Cursor::ok() const
+{
+  return d_ok;
+}
+
+// columns are bound in order by Inserter::insert(). If returnfield is given, it is
+// available from returned() after each insert
+inline SqliteDB::Inserter SqliteDB::inserter(std::string const &table, std::vector<std::string> const &columns,
+                                             std::string const &returnfield, unsigned int batchsize) const
+{
+  std::string q = "INSERT INTO " + table + " (";
+  for (uint i = 0; i < columns.size(); ++i)
+    q += columns[i] + (i < columns.size() - 1 ? ", " : ") ");
+  q += "VALUES (";
+  for (uint i = 0; i < columns.size(); ++i)
+    q += (i < columns.size() - 1 ? "?, " : "?)");
+  if (!returnfield.empty())
+    q += " RETURNING " + returnfield;
+  return Inserter(this, q, batchsize);
+}
+
+inline SqliteDB::Inserter::Inserter(SqliteDB const *db, std::string const &q, unsigned int batchsize)
+  :
+  d_db(db),
+  d_stmt(nullptr),
+  d_query(q),
+  d_batchsize(batchsize ? batchsize : 1),
+  d_inbatch(0),
+  d_owntransaction(false)
+{}
+
+inline SqliteDB::Inserter::Inserter(Inserter &&other)
+  :
+  d_db(other.d_db),
+  d_stmt(other.d_stmt),
+  d_query(std::move(other.d_query)),
+  d_returned(std::move(other.d_returned)),
+  d_batchsize(other.d_batchsize),
+  d_inbatch(other.d_inbatch),
+  d_owntransaction(other.d_owntransaction)
+{
+  other.d_stmt = nullptr;
+  other.d_owntransaction = false;
+}
+
+inline SqliteDB::Inserter::~Inserter()
+{
+  commit();
+  if (d_stmt)
+    d_db->cacheStatement(d_query, d_stmt);
+}
+
+template <typename... Values>
+inline bool SqliteDB::Inserter::insert(Values const &... values)
+{
+  if (!prepare()) [[unlikely]]
+    return false;
+
+  int count = 0;
+  if (!((d_db->execParamFiller(d_stmt, ++count, values) == SQLITE_OK) && ...)) [[unlikely]]
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
+      "During sqlite3_bind_*(): " << sqlite3_errmsg(d_db->d_db) << std::endl <<
+      "  Query: \"" << d_query << "\"" << std::endl;
+    sqlite3_clear_bindings(d_stmt);
+    return false;
+  }
+  return step();
+}
+
+// for a number of columns only known at runtime
+inline bool SqliteDB::Inserter::insert(std::vector<std::any> const &values)
+{
+  if (!prepare()) [[unlikely]]
+    return false;
+
+  if (!d_db->bindParameters(d_stmt, d_query, values)) [[unlikely]]
+  {
+    sqlite3_clear_bindings(d_stmt);
+    return false;
+  }
+  return step();
+}
+
+inline bool SqliteDB::Inserter::prepare()
+{
+  if (!d_stmt && !(d_stmt = d_db->prepareStatement(d_query))) [[unlikely]]
+    return false;
+
+  if (!d_owntransaction && sqlite3_get_autocommit(d_db->d_db))
+  {
+    if (!d_db->beginSavepoint("inserter"))
+      return false;
+    d_owntransaction = true;
+    d_inbatch = 0;
+  }
+  return true;
+}
+
+inline bool SqliteDB::Inserter::step()
+{
+  int rc = sqlite3_step(d_stmt);
+  if (rc == SQLITE_ROW) // RETURNING
+  {
+    d_returned.clear();
+    fillRow(d_stmt, &d_returned, 0);
+    rc = sqlite3_step(d_stmt);
+  }
+  // the statement stays usable after a failed row (eg a constraint violation)
+  sqlite3_reset(d_stmt);
+  if (rc != SQLITE_DONE) [[unlikely]]
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
+      "After sqlite3_step(): " << sqlite3_errmsg(d_db->d_db) << std::endl <<
+      "  Query: \"" << d_query << "\"" << std::endl;
+    return false;
+  }
+
+  if (d_owntransaction && ++d_inbatch >= d_batchsize)
+    return commit();
+  return true;
+}
+
+// commits the rows inserted since the last batch, if this inserter started the transaction
+inline bool SqliteDB::Inserter::commit()
+{
+  if (!d_owntransaction)
+    return true;
+  d_owntransaction = false;
+  d_inbatch = 0;
+  return d_db->releaseSavepoint("inserter");
+}
+
+// rowid of the last inserted row
+inline long long int SqliteDB::Inserter::lastInsertRowid() const
+{
+  return sqlite3_last_insert_rowid(d_db->d_db);
+}
+
+inline SqliteDB::QueryResults const &SqliteDB::Inserter::returned() const
+{
+  return d_returned;
+}
+
+inline SqliteDB::Snapshot::Snapshot(unsigned char *data, sqlite3_int64 size)
+  :
+  d_data(data),
+  d_size(size)
+{}
+
+inline SqliteDB::Snapshot::Snapshot(Snapshot &&other)
+  :
+  d_data(other.d_data),
+  d_size(other.d_size)
+{
+  other.d_data = nullptr;
+  other.d_size = 0;
+}
+
+inline SqliteDB::Snapshot::~Snapshot()
+{
+  if (d_data)
+    sqlite3_free(d_data);
+}
+
+inline bool SqliteDB::Snapshot::ok() const
+{
+  return d_data != nullptr;
+}
+
+template <typename Binder>
+inline bool SqliteDB::execWithBinder(std::string const &q, Binder const &bindparameters, QueryResults *results) const
+{
+  sqlite3_stmt *stmt = prepareStatement(q);
+  if (!stmt) [[unlikely]]
+    return false;
+
+  if (bindparameters(stmt) != SQLITE_OK) [[unlikely]]
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
+      "During sqlite3_bind_*(): " << sqlite3_errmsg(d_db) << std::endl <<
+      "  Query: \"" << q << "\"" << std::endl;
+    sqlite3_finalize(stmt);
     return false;
   }
 
+  return stepStatement(stmt, q, results);
+}
+
+template <typename R>
+inline bool SqliteDB::bindParameters(sqlite3_stmt *stmt, std::string const &q, R const &params) const
+{
   if (static_cast<int>(params.size()) != sqlite3_bind_parameter_count(stmt)) [[unlikely]]
   {
     if (sqlite3_bind_parameter_count(stmt) < static_cast<int>(params.size()))
@@ -344,58 +1105,42 @@ inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &pa
     ++i;
   }
 
-  if (results)
-    results->clear();
-  int rc;
-  int row = 0;
-  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
-  {
-    if (!results)
-      continue;
+  return true;
+}
 
-    // if headers aren't set, set them
-    if (results->columns() == 0)
-      for (int c = 0; c < sqlite3_column_count(stmt); ++c)
-        results->emplaceHeader(sqlite3_column_name(stmt, c));
+inline bool SqliteDB::ok() const
+{
+  return d_ok;
+}
 
-    // set values
-    for (int c = 0; c < sqlite3_column_count(stmt); ++c)
-    {
-      if (sqlite3_column_type(stmt, c) == SQLITE_INTEGER)
-        results->emplaceValue(row, sqlite3_column_int64(stmt, c));
-      else if (sqlite3_column_type(stmt, c) == SQLITE_FLOAT)
-        results->emplaceValue(row, sqlite3_column_double(stmt, c));
-      else if (sqlite3_column_type(stmt, c) == SQLITE_TEXT)
-        results->emplaceValue(row, std::string(reinterpret_cast<char const *>(sqlite3_column_text(stmt, c))));
-      else if (sqlite3_column_type(stmt, c) == SQLITE_NULL)
-        results->emplaceValue(row, nullptr);
-      else if (sqlite3_column_type(stmt, c) == SQLITE_BLOB)
-      {
-        size_t blobsize = sqlite3_column_bytes(stmt, c);
-        std::shared_ptr<unsigned char []> blob(new unsigned char[blobsize]);
-        std::memcpy(blob.get(), reinterpret_cast<unsigned char const *>(sqlite3_column_blob(stmt, c)), blobsize);
-        results->emplaceValue(row, std::make_pair(blob, blobsize));
-      }
-    }
-    ++row;
-  }
-  if (rc != SQLITE_DONE)
-  {
-    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
-      "After sqlite3_step(): " << sqlite3_errmsg(d_db) << std::endl <<
-      "  Query: \"" << q << "\"" << std::endl;
+inline bool SqliteDB::exec(std::string const &q, QueryResults *results) const
+{
+  return exec(q, std::vector<std::any>(), results);
+}
+
+inline bool SqliteDB::exec(std::string const &q, std::any const &param, QueryResults *results) const
+{
+  return exec(q, std::vector<std::any>{param}, results);
+}
+
+#if __cpp_lib_ranges >= 201911L && !defined(__clang__)
+template <typename R> requires std::ranges::input_range<R> && std::is_same<std::any, std::ranges::range_value_t<R>>::value
+inline bool SqliteDB::exec(std::string const &q, R &&params, QueryResults *results) const
+#else
+inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &params, QueryResults *results) const
+#endif
+{
+  sqlite3_stmt *stmt = prepareStatement(q);
+  if (!stmt) [[unlikely]]
     return false;
-  }
 
-  if (sqlite3_finalize(stmt) != SQLITE_OK)
+  if (!bindParameters(stmt, q, params)) [[unlikely]]
   {
-    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
-      "During sqlite3_finalize(): " << sqlite3_errmsg(d_db) << std::endl <<
-      "  Query: \"" << q << "\"" << std::endl;
+    sqlite3_finalize(stmt);
     return false;
   }
 
-  return true;
+  return stepStatement(stmt, q, results);
 }
 
 #if __cpp_lib_ranges >= 201911L && !defined(__clang__)
@@ -567,18 +1312,32 @@ inline long long int SqliteDB::lastInsertRowid() const
 
 inline bool SqliteDB::containsTable(std::string const &tablename) const
 {
+  checkSchemaCache();
+  auto it = d_tablecache.find(tablename);
+  if (it != d_tablecache.end())
+    return it->second;
+
   QueryResults tmp;
-  if (exec("SELECT DISTINCT tbl_name FROM sqlite_master WHERE type = 'table' AND tbl_name = '" + tablename + "'", &tmp))
-    return (tmp.rows() > 0);
-  return false;
+  if (!exec("SELECT DISTINCT tbl_name FROM sqlite_master WHERE type = 'table' AND tbl_name = ?", tablename, &tmp))
+    return false;
+  return d_tablecache.emplace(tablename, tmp.rows() > 0).first->second;
 }
 
 inline bool SqliteDB::tableContainsColumn(std::string const &tablename, std::string const &columnname) const
 {
-  QueryResults tmp;
-  if (exec("SELECT 1 FROM PRAGMA_TABLE_XINFO('" + tablename + "') WHERE name == '" + columnname + "'", &tmp))
-    return (tmp.rows() > 0);
-  return false;
+  checkSchemaCache();
+  auto it = d_columncache.find(tablename);
+  if (it == d_columncache.end())
+  {
+    QueryResults tmp;
+    if (!exec("SELECT name FROM PRAGMA_TABLE_XINFO(?)", tablename, &tmp))
+      return false;
+    std::unordered_set<std::string> columns;
+    for (uint i = 0; i < tmp.rows(); ++i)
+      columns.emplace(tmp.valueAsString(i, 0));
+    it = d_columncache.emplace(tablename, std::move(columns)).first;
+  }
+  return it->second.find(columnname) != it->second.end();
 }
 
 template <typename... columnnames>
@@ -587,14 +1346,104 @@ inline bool SqliteDB::tableContainsColumn(std::string const &tablename, std::str
   return tableContainsColumn(tablename, columnname) && tableContainsColumn(tablename, list...);
 }
 
+inline void SqliteDB::checkSchemaCache() const
+{
+  if (!d_schemacheck) [[likely]]
+    return;
+  d_schemacheck = false;
+
+  long long int version = getSingleResultAs<long long int>("PRAGMA schema_version", -1);
+  if (version == d_schemaversion && version != -1)
+    return;
+  d_tablecache.clear();
+  d_columncache.clear();
+  d_schemaversion = version;
+}
+
+// for schema changes not made through this object (eg copyDb())
+inline void SqliteDB::invalidateSchemaCache() const
+{
+  d_tablecache.clear();
+  d_columncache.clear();
+  d_schemaversion = -1;
+  d_schemacheck = true;
+}
+
 inline void SqliteDB::freeMemory()
 {
+  clearStatementCache();
   sqlite3_db_release_memory(d_db);
 }
 
+inline sqlite3_stmt *SqliteDB::takeCachedStatement(std::string const &q) const
+{
+  auto it = d_statementcacheindex.find(q);
+  if (it == d_statementcacheindex.end())
+  {
+    ++d_statementcachemisses;
+    return nullptr;
+  }
+  ++d_statementcachehits;
+  sqlite3_stmt *stmt = it->second->second;
+  d_statementcache.erase(it->second);
+  d_statementcacheindex.erase(it);
+  return stmt;
+}
+
+inline void SqliteDB::cacheStatement(std::string const &q, sqlite3_stmt *stmt) const
+{
+  sqlite3_reset(stmt);
+  sqlite3_clear_bindings(stmt);
+
+  // the same query may have been cached by a reentrant exec() in the meantime
+  if (d_statementcacheindex.find(q) != d_statementcacheindex.end())
+  {
+    sqlite3_finalize(stmt);
+    return;
+  }
+
+  d_statementcache.emplace_front(q, stmt);
+  d_statementcacheindex.emplace(q, d_statementcache.begin());
+  if (d_statementcache.size() > s_statementcachesize)
+  {
+    sqlite3_finalize(d_statementcache.back().second);
+    d_statementcacheindex.erase(d_statementcache.back().first);
+    d_statementcache.pop_back();
+  }
+}
+
+inline void SqliteDB::clearStatementCache() const
+{
+  for (auto const &s : d_statementcache)
+    sqlite3_finalize(s.second);
+  d_statementcache.clear();
+  d_statementcacheindex.clear();
+}
+
+inline uint64_t SqliteDB::statementCacheHits() const
+{
+  return d_statementcachehits;
+}
+
+inline uint64_t SqliteDB::statementCacheMisses() const
+{
+  return d_statementcachemisses;
+}
+
+inline void SqliteDB::printStatementCacheStats() const
+{
+  uint64_t total = d_statementcachehits + d_statementcachemisses;
+  std::cout << "Prepared statement cache: " << d_statementcachehits << " hits, " << d_statementcachemisses << " misses";
+  if (total)
+    std::cout << " (hit rate " << std::fixed << std::setprecision(1) << (100.0 * d_statementcachehits) / total << "%)" << std::defaultfloat;
+  std::cout << std::endl;
+}
+
 inline void SqliteDB::QueryResults::emplaceHeader(std::string &&h)
 {
-  d_headers.emplace_back(h);
+  d_headerindex.emplace(h, d_headers.size());
+  d_headers.emplace_back(std::move(h));
+  d_columns.resize(d_headers.size());
 }
 
 inline std::string const &SqliteDB::QueryResults::header(size_t idx) const
@@ -607,25 +1456,117 @@ inline std::vector<std::string> const &SqliteDB::QueryResults::headers() const
   return d_headers;
 }
 
-inline void SqliteDB::QueryResults::emplaceValue(size_t row, std::any &&a)
+// values are added row by row, left to right
+inline SqliteDB::QueryResults::Cell &SqliteDB::QueryResults::newCell(size_t row)
 {
-  if (d_values.size() < row + 1)
-    d_values.resize(row + 1);
+  if (row >= d_rows)
+  {
+    d_rows = row + 1;
+    d_nextcolumn = 0;
+  }
+  if (d_nextcolumn >= d_columns.size())
+    d_columns.resize(d_nextcolumn + 1);
+  std::vector<Cell> &column = d_columns[d_nextcolumn++];
+  column.resize(row + 1);
+  return column.back();
+}
+
+inline void SqliteDB::QueryResults::emplaceValue(size_t row, long long int value)
+{
+  Cell &c = newCell(row);
+  c.type = ValueType::INTEGER;
+  c.intvalue = value;
+}
 
-  d_values[row].emplace_back(a);
+inline void SqliteDB::QueryResults::emplaceValue(size_t row, double value)
+{
+  Cell &c = newCell(row);
+  c.type = ValueType::FLOAT;
+  c.doublevalue = value;
 }
 
-inline std::any const &SqliteDB::QueryResults::value(size_t row, size_t idx) const
+inline void SqliteDB::QueryResults::emplaceValue(size_t row, std::string_view value)
 {
-  return d_values[row][idx];
+  Cell &c = newCell(row);
+  c.type = ValueType::TEXT;
+  c.offset = d_arena.size();
+  c.size = value.size();
+  d_arena.append(value);
+}
+
+inline void SqliteDB::QueryResults::emplaceValue(size_t row, std::nullptr_t)
+{
+  Cell &c = newCell(row);
+  c.type = ValueType::NULLVALUE;
+  c.intvalue = 0;
+}
+
+inline void SqliteDB::QueryResults::emplaceValue(size_t row, unsigned char const *blob, size_t size)
+{
+  Cell &c = newCell(row);
+  c.type = ValueType::BLOB;
+  c.offset = d_arena.size();
+  c.size = size;
+  d_arena.append(reinterpret_cast<char const *>(blob), size);
+}
+
+inline void SqliteDB::QueryResults::appendCell(size_t row, Cell const &cell, QueryResults const &source)
+{
+  if (cell.type == ValueType::TEXT || cell.type == ValueType::BLOB)
+  {
+    Cell &c = newCell(row);
+    c.type = cell.type;
+    c.offset = d_arena.size();
+    c.size = cell.size;
+    d_arena.append(source.d_arena, cell.offset, cell.size);
+  }
+  else
+    newCell(row) = cell;
+}
+
+inline SqliteDB::QueryResults::ValueType SqliteDB::QueryResults::valueType(size_t row, size_t idx) const
+{
+  return d_columns[idx][row].type;
+}
+
+// valid until the results are modified
+inline std::string_view SqliteDB::QueryResults::textView(size_t row, size_t idx) const
+{
+  Cell const &c = d_columns[idx][row];
+  return std::string_view(d_arena.data() + c.offset, c.size);
+}
+
+// valid until the results are modified
+inline std::pair<unsigned char const *, size_t> SqliteDB::QueryResults::blobView(size_t row, size_t idx) const
+{
+  Cell const &c = d_columns[idx][row];
+  return {reinterpret_cast<unsigned char const *>(d_arena.data()) + c.offset, c.size};
+}
+
+inline std::any SqliteDB::QueryResults::value(size_t row, size_t idx) const
+{
+  switch (d_columns[idx][row].type)
+  {
+    case ValueType::INTEGER:
+      return getValueAs<long long int>(row, idx);
+    case ValueType::FLOAT:
+      return getValueAs<double>(row, idx);
+    case ValueType::TEXT:
+      return getValueAs<std::string>(row, idx);
+    case ValueType::BLOB:
+      return getValueAs<std::pair<std::shared_ptr<unsigned char []>, size_t>>(row, idx);
+    case ValueType::NULLVALUE:
+    default:
+      return std::any{nullptr};
+  }
 }
 
 inline int SqliteDB::QueryResults::idxOfHeader(std::string const &header) const
 {
-  for (uint i = 0; i < d_headers.size(); ++i)
-    if (d_headers[i] == header)
-      return i;
-  [[unlikely]] return -1;
+  auto it = d_headerindex.find(header);
+  if (it != d_headerindex.end()) [[likely]]
+    return it->second;
+  return -1;
 }
 
 inline std::any SqliteDB::QueryResults::value(size_t row, std::string const &header) const
@@ -637,7 +1578,7 @@ inline std::any SqliteDB::QueryResults::value(size_t row, std::string const &hea
               << ": Column `" << header << "' not found in query results" << std::endl;
     return std::any{nullptr};
   }
-  return d_values[row][i];
+  return value(row, i);
 }
 
 template <typename T>
@@ -651,13 +1592,13 @@ inline T SqliteDB::QueryResults::getValueAs(size_t row, std::string const &heade
     return T{};
   }
 
-  if (d_values[row][i].type() != typeid(T)) [[unlikely]]
+  if (!valueHasType<T>(row, i)) [[unlikely]]
   {
     std::cout << "Getting value of field '" << header << "' (idx " << i << "). Value as string: " << valueAsString(row, i) << std::endl;
-    std::cout << "Type: " << d_values[row][i].type().name() << " Requested type: " << typeid(T).name() << std::endl;
+    std::cout << "Type: " << static_cast<int>(valueType(row, i)) << " Requested type: " << typeid(T).name() << std::endl;
     //return T{};
   }
-  return std::any_cast<T>(d_values[row][i]);
+  return getValueAs<T>(row, i);
 }
 
 template <typename T>
@@ -670,13 +1611,24 @@ inline bool SqliteDB::QueryResults::valueHasType(size_t row, std::string const &
               << ": Column `" << header << "' not found in query results" << std::endl;
     return false;
   }
-  return (d_values[row][i].type() == typeid(T));
+  return valueHasType<T>(row, i);
 }
 
 template <typename T>
 inline bool SqliteDB::QueryResults::valueHasType(size_t row, size_t idx) const
 {
-  return (d_values[row][idx].type() == typeid(T));
+  if constexpr (std::is_same_v<T, long long int>)
+    return d_columns[idx][row].type == ValueType::INTEGER;
+  else if constexpr (std::is_same_v<T, double>)
+    return d_columns[idx][row].type == ValueType::FLOAT;
+  else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>)
+    return d_columns[idx][row].type == ValueType::TEXT;
+  else if constexpr (std::is_same_v<T, std::pair<std::shared_ptr<unsigned char []>, size_t>>)
+    return d_columns[idx][row].type == ValueType::BLOB;
+  else if constexpr (std::is_same_v<T, std::nullptr_t>)
+    return d_columns[idx][row].type == ValueType::NULLVALUE;
+  else // no other types are ever stored
+    return false;
 }
 
 inline bool SqliteDB::QueryResults::isNull(size_t row, size_t idx) const
@@ -689,20 +1641,38 @@ inline bool SqliteDB::QueryResults::isNull(size_t row, std::string const &header
   return valueHasType<std::nullptr_t>(row, header);
 }
 
+// like std::any_cast, throws std::bad_any_cast if the value does not have type T
 template <typename T>
 inline T SqliteDB::QueryResults::getValueAs(size_t row, size_t idx) const
 {
-  return std::any_cast<T>(d_values[row][idx]);
+  if (!valueHasType<T>(row, idx)) [[unlikely]]
+    throw std::bad_any_cast();
+
+  Cell const &c = d_columns[idx][row];
+  if constexpr (std::is_same_v<T, long long int>)
+    return c.intvalue;
+  else if constexpr (std::is_same_v<T, double>)
+    return c.doublevalue;
+  else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>)
+    return T(d_arena.data() + c.offset, c.size);
+  else if constexpr (std::is_same_v<T, std::pair<std::shared_ptr<unsigned char []>, size_t>>)
+  {
+    std::shared_ptr<unsigned char []> blob(new unsigned char[c.size]);
+    std::memcpy(blob.get(), d_arena.data() + c.offset, c.size);
+    return std::make_pair(blob, static_cast<size_t>(c.size));
+  }
+  else
+    return T{};
 }
 
 inline bool SqliteDB::QueryResults::empty() const
 {
-  return d_values.empty();
+  return d_rows == 0;
 }
 
 inline size_t SqliteDB::QueryResults::rows() const
 {
-  return d_values.size();
+  return d_rows;
 }
 
 inline size_t SqliteDB::QueryResults::columns() const
@@ -713,7 +1683,21 @@ inline size_t SqliteDB::QueryResults::columns() const
 inline void SqliteDB::QueryResults::clear()
 {
   d_headers.clear();
-  d_values.clear();
+  d_headerindex.clear();
+  d_columns.clear();
+  d_arena.clear();
+  d_rows = 0;
+  d_nextcolumn = 0;
+}
+
+// removes all values, keeping the headers (and allocated memory) for the next rows
+inline void SqliteDB::QueryResults::clearRows()
+{
+  for (auto &column : d_columns)
+    column.clear();
+  d_arena.clear();
+  d_rows = 0;
+  d_nextcolumn = 0;
 }
 
 inline std::string SqliteDB::QueryResults::operator()(size_t row, std::string const &header) const
@@ -729,17 +1713,21 @@ inline std::string SqliteDB::QueryResults::operator()(std::string const &header)
 template <typename T>
 inline bool SqliteDB::QueryResults::contains(T const &value) const
 {
-  for (uint i = 0; i < d_values.size(); ++i)
-    for (uint j = 0; j < d_values[i].size(); ++j)
-      if (d_values[i][j].type() == typeid(T))
-        if (std::any_cast<T>(d_values[i][j]) == value)
+  for (uint j = 0; j < d_columns.size(); ++j)
+    for (uint i = 0; i < d_rows; ++i)
+      if (valueHasType<T>(i, j))
+        if (getValueAs<T>(i, j) == value)
           return true;
   return false;
 }
 
-inline std::vector<std::any> const &SqliteDB::QueryResults::row(size_t row) const
+inline std::vector<std::any> SqliteDB::QueryResults::row(size_t row) const
 {
-  return d_values[row];
+  std::vector<std::any> ret;
+  ret.reserve(d_columns.size());
+  for (uint i = 0; i < d_columns.size(); ++i)
+    ret.emplace_back(value(row, i));
+  return ret;
 }
 
 bool SqliteDB::QueryResults::useEscapeCodes() const
@@ -775,10 +1763,13 @@ inline uint64_t SqliteDB::QueryResults::charCount(std::string const &utf8) const
 
 inline bool SqliteDB::QueryResults::removeRow(uint idx)
 {
-  if (idx >= d_values.size())
+  if (idx >= d_rows)
     return false;
 
-  d_values.erase(d_values.begin() + idx);
+  // (any text/blob data stays in the arena until clear())
+  for (auto &column : d_columns)
+    column.erase(column.begin() + idx);
+  --d_rows;
   return true;
 }
 
@@ -786,16 +1777,77 @@ inline SqliteDB::QueryResults SqliteDB::QueryResults::getRow(uint idx)
 {
   QueryResults tmp;
   tmp.d_headers = d_headers;
-  tmp.d_values.push_back(d_values[idx]);
+  tmp.d_headerindex = d_headerindex;
+  tmp.d_columns.resize(d_columns.size());
+  for (uint i = 0; i < d_columns.size(); ++i)
+    tmp.appendCell(0, d_columns[i][idx], *this);
   return tmp;
 }
 
 inline bool SqliteDB::registerCustoms() const
 {
+  if (s_profiling) [[unlikely]]
+    if (sqlite3_trace_v2(d_db, SQLITE_TRACE_STMT | SQLITE_TRACE_ROW | SQLITE_TRACE_PROFILE, &profileCallback, const_cast<SqliteDB *>(this)) != SQLITE_OK)
+      return false;
+
   return sqlite3_create_function(d_db, "TOKENCOUNT", -1, SQLITE_UTF8, nullptr, &tokencount, nullptr, nullptr) == SQLITE_OK &&
     sqlite3_create_function(d_db, "TOKEN", -1, SQLITE_UTF8, nullptr, &token, nullptr, nullptr) == SQLITE_OK;
 }
 
+// only affects databases opened after this call
+inline void SqliteDB::setProfiling(bool profile) // static
+{
+  s_profiling = profile;
+}
+
+// called by sqlite when a statement starts running, for every result row, and when it has
+// finished. The time sqlite reports itself has only millisecond resolution on most systems
+inline int SqliteDB::profileCallback(unsigned int type, void *userdata, void *p, void *x) // static
+{
+  SqliteDB const *db = reinterpret_cast<SqliteDB const *>(userdata);
+  sqlite3_stmt *stmt = reinterpret_cast<sqlite3_stmt *>(p);
+
+  if (type == SQLITE_TRACE_STMT)
+  {
+    if (!STRING_STARTS_WITH(std::string_view(reinterpret_cast<char const *>(x)), "--")) // not a trigger starting
+      db->d_profilerunning[stmt] = {0, std::chrono::steady_clock::now()};
+    return 0;
+  }
+
+  auto it = db->d_profilerunning.find(stmt);
+  if (it == db->d_profilerunning.end())
+    return 0;
+
+  if (type == SQLITE_TRACE_ROW)
+  {
+    ++it->second.first;
+    return 0;
+  }
+
+  if (type != SQLITE_TRACE_PROFILE)
+    return 0;
+
+  uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - it->second.second).count();
+  uint64_t rows = it->second.first;
+  db->d_profilerunning.erase(it);
+  // the counters are reset, cached statements are reused
+  uint64_t vmsteps = sqlite3_stmt_status(stmt, SQLITE_STMTSTATUS_VM_STEP, 1);
+  uint64_t fullscansteps = sqlite3_stmt_status(stmt, SQLITE_STMTSTATUS_FULLSCAN_STEP, 1);
+  uint64_t sorts = sqlite3_stmt_status(stmt, SQLITE_STMTSTATUS_SORT, 1);
+  std::string query(normalizeQuery(sqlite3_sql(stmt)));
+
+  std::lock_guard<std::mutex> lock(s_profilemutex);
+  QueryProfile &qp = s_profile.try_emplace(std::move(query), QueryProfile{0, 0, 0, 0, 0, 0, 0}).first->second;
+  ++qp.calls;
+  qp.rows += rows;
+  qp.vmsteps += vmsteps;
+  qp.fullscansteps += fullscansteps;
+  qp.sorts += sorts;
+  qp.totalns += ns;
+  qp.maxns = std::max(qp.maxns, ns);
+  return 0;
+}
+
 inline void SqliteDB::tokencount(sqlite3_context *context, int argc, sqlite3_value **argv) //static
 {
   if (argc == 0)
@@ -43,8 +43,7 @@ std::string SqliteDB::QueryResults::valueAsString(size_t row, size_t column) con
     return std::string();
 
   if (valueHasType<std::pair<std::shared_ptr<unsigned char []>, size_t>>(row, column))
-    return Base64::bytesToBase64String(getValueAs<std::pair<std::shared_ptr<unsigned char []>, size_t>>(row, column).first.get(),
-                                       getValueAs<std::pair<std::shared_ptr<unsigned char []>, size_t>>(row, column).second);
+    return Base64::bytesToBase64String(blobView(row, column).first, blobView(row, column).second);
 
   else [[unlikely]]
     return "(unhandled type)";
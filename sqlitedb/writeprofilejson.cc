@@ -0,0 +1,59 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlitedb.ih"
+
+#include <fstream>
+
+// writes all gathered query statistics (see setProfiling()) as a JSON array
+bool SqliteDB::writeProfileJson(std::string const &filename) // static
+{
+  std::ofstream out(filename, std::ios_base::binary);
+  if (!out.is_open())
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : Failed to open '" << filename << "' for writing" << std::endl;
+    return false;
+  }
+
+  auto jsonstring = [](std::string const &s)
+  {
+    std::string result("\"");
+    for (char c : s)
+    {
+      if (c == '"' || c == '\\')
+        (result += '\\') += c;
+      else if (static_cast<unsigned char>(c) < 0x20)
+        result += "\\u00" + bepaald::toString(static_cast<unsigned char>(c) >> 4, true) + bepaald::toString(c & 0xf, true);
+      else
+        result += c;
+    }
+    return result + "\"";
+  };
+
+  std::lock_guard<std::mutex> lock(s_profilemutex);
+  out << "[" << std::endl;
+  uint count = 0;
+  for (auto const &[query, qp] : s_profile)
+    out << "  {\"query\": " << jsonstring(query) << ", \"calls\": " << qp.calls << ", \"total_ns\": " << qp.totalns
+        << ", \"max_ns\": " << qp.maxns << ", \"rows\": " << qp.rows << ", \"vm_steps\": " << qp.vmsteps
+        << ", \"fullscan_steps\": " << qp.fullscansteps << ", \"sorts\": " << qp.sorts << "}"
+        << (++count < s_profile.size() ? "," : "") << std::endl;
+  out << "]" << std::endl;
+  return out.good();
+}
@@ -0,0 +1,74 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlstatementframe.ih"
+
+// binds the parameters straight from the frame data, without copying. The statement
+// must be done (reset, or bindings cleared) before this frame is destroyed.
+int SqlStatementFrame::bindParameters(sqlite3_stmt *stmt) const
+{
+  if (static_cast<int>(d_parameterdata.size()) != sqlite3_bind_parameter_count(stmt)) [[unlikely]]
+  {
+    if (sqlite3_bind_parameter_count(stmt) < static_cast<int>(d_parameterdata.size()))
+      std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off << ": " << "Too few placeholders in query!";
+    else if (sqlite3_bind_parameter_count(stmt) > static_cast<int>(d_parameterdata.size()))
+      std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off << ": " << "Too many placeholders in query!";
+    std::cout << " \"" << sqlite3_sql(stmt) << "\" (parameters: " << d_parameterdata.size()
+              << ", placeholders: " << sqlite3_bind_parameter_count(stmt) << ")" << std::endl;
+  }
+
+  int idx = 1;
+  for (auto const &p : d_parameterdata)
+  {
+    int rc = SQLITE_OK;
+    switch (std::get<0>(p))
+    {
+      case PARAMETER_FIELD::INT:
+        rc = sqlite3_bind_int64(stmt, idx, static_cast<long long int>(bytesToUint64(std::get<1>(p), std::get<2>(p))));
+        break;
+      case PARAMETER_FIELD::STRING:
+      {
+        // strings were previously bound up to the first '\0', an empty string is not NULL
+        char const *str = std::get<1>(p) ? reinterpret_cast<char const *>(std::get<1>(p)) : "";
+        rc = sqlite3_bind_text(stmt, idx, str, strnlen(str, std::get<2>(p)), SQLITE_STATIC);
+        break;
+      }
+      case PARAMETER_FIELD::DOUBLE:
+      {
+        double val;
+        std::memcpy(&val, std::get<1>(p), sizeof(double));
+        rc = sqlite3_bind_double(stmt, idx, val);
+        break;
+      }
+      case PARAMETER_FIELD::BLOB:
+        if (std::get<2>(p) == 0) // an empty blob is not NULL
+          rc = sqlite3_bind_zeroblob(stmt, idx, 0);
+        else
+          rc = sqlite3_bind_blob64(stmt, idx, std::get<1>(p), std::get<2>(p), SQLITE_STATIC);
+        break;
+      case PARAMETER_FIELD::NULLPARAMETER:
+        rc = sqlite3_bind_null(stmt, idx);
+        break;
+    }
+    if (rc != SQLITE_OK) [[unlikely]]
+      return rc;
+    ++idx;
+  }
+  return SQLITE_OK;
+}
@@ -0,0 +1,52 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlstatementframe.ih"
+
+// for CREATE statements, returns the type (uppercase: "TABLE", "VIEW",
+// "INDEX", "UNIQUE INDEX", "TRIGGER") and name of the created object. Empty otherwise
+std::pair<std::string, std::string> SqlStatementFrame::createdObject() const
+{
+  std::string const statement(bindStatement());
+  std::string::size_type pos = 0;
+
+  if (bepaald::toUpper(nextToken(statement, &pos)) != "CREATE")
+    return {std::string(), std::string()};
+
+  bool unique = false;
+  std::string type = bepaald::toUpper(nextToken(statement, &pos));
+  while (type == "TEMP" || type == "TEMPORARY" || type == "UNIQUE" || type == "VIRTUAL")
+  {
+    unique = unique || type == "UNIQUE";
+    type = bepaald::toUpper(nextToken(statement, &pos));
+  }
+  if (type != "TABLE" && type != "VIEW" && type != "INDEX" && type != "TRIGGER")
+    return {std::string(), std::string()};
+  if (unique && type == "INDEX")
+    type = "UNIQUE INDEX";
+
+  std::string name = nextToken(statement, &pos);
+  if (bepaald::toUpper(name) == "IF") // IF NOT EXISTS
+  {
+    nextToken(statement, &pos);
+    nextToken(statement, &pos);
+    name = nextToken(statement, &pos);
+  }
+  return {type, name};
+}
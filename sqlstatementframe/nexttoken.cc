@@ -0,0 +1,52 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlstatementframe.ih"
+
+// returns the next token of statement (starting at *pos), unquoted
+// identifiers, words, or a single '('. Advances *pos past the token
+std::string SqlStatementFrame::nextToken(std::string const &statement, std::string::size_type *pos) // static
+{
+  while (*pos < statement.size() && std::isspace(static_cast<unsigned char>(statement[*pos])))
+    ++(*pos);
+  if (*pos >= statement.size())
+    return std::string();
+
+  char close = 0;
+  if (statement[*pos] == '"' || statement[*pos] == '`' || statement[*pos] == '\'')
+    close = statement[*pos];
+  else if (statement[*pos] == '[')
+    close = ']';
+  if (close)
+  {
+    std::string::size_type end = statement.find(close, *pos + 1);
+    if (end == std::string::npos)
+      end = statement.size();
+    std::string token(statement.substr(*pos + 1, end - *pos - 1));
+    *pos = end + 1;
+    return token;
+  }
+
+  std::string::size_type start = *pos;
+  while (*pos < statement.size() && !std::isspace(static_cast<unsigned char>(statement[*pos])) && statement[*pos] != '(')
+    ++(*pos);
+  if (*pos == start) // '('
+    return std::string(1, statement[(*pos)++]);
+  return statement.substr(start, *pos - start);
+}
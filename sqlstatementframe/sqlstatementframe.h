@@ -25,9 +25,13 @@
 #include <memory>
 #include <vector>
 #include <any>
+#include <string_view>
+#include <cctype>
 
 #include "../backupframe/backupframe.h"
 
+struct sqlite3_stmt;
+
 struct Period final : std::numpunct<char>
 {
   char do_decimal_point() const override { return '.'; } // make sure std::to_string always uses period for
@@ -73,17 +77,24 @@ class SqlStatementFrame : public BackupFrame
 
   inline std::string const &statement();
   inline std::pair<unsigned char *, uint64_t> getData() const override;
+  inline uint64_t dataSize() const;
+  inline void putData(unsigned char *data, uint64_t size) const;
 
   inline void setStatementField(std::string const &val);
-  inline void addStringParameter(std::string const &val);
+  inline void addStringParameter(std::string_view val);
   inline void addBlobParameter(std::pair<std::shared_ptr<unsigned char []>, size_t> const &val);
+  inline void addBlobParameter(std::pair<unsigned char const *, size_t> const &val);
   inline void addIntParameter(int64_t val);
   inline void addNullParameter();
   inline void addDoubleParameter(double val);
   inline void addParameterField(PARAMETER_FIELD field, std::string const &val);
 
   inline std::string bindStatement() const;
+  std::string tableName() const;
+  std::pair<std::string, std::string> createdObject() const;
+  inline bool isInsertStatement() const;
   inline std::vector<std::any> parameters() const;
+  int bindParameters(sqlite3_stmt *stmt) const;
 
   // inline void setParameter(uint idx, unsigned char *data, uint32_t length);
   // inline void getParameter(uint idx) const;
@@ -94,7 +105,7 @@ class SqlStatementFrame : public BackupFrame
 
  private:
   void buildStatement();
-  inline uint64_t dataSize() const;
+  static std::string nextToken(std::string const &statement, std::string::size_type *pos);
 };
 
 inline SqlStatementFrame::SqlStatementFrame()
@@ -379,6 +390,13 @@ inline std::pair<unsigned char *, uint64_t> SqlStatementFrame::getData() const
 {
   uint64_t size = dataSize();
   unsigned char *data = new unsigned char[size];
+  putData(data, size);
+  return {data, size};
+}
+
+// serializes the frame into data, which must hold size (== dataSize()) bytes
+inline void SqlStatementFrame::putData(unsigned char *data, uint64_t size) const
+{
   uint64_t datapos = 0;
 
   datapos += setFieldAndWire(FRAMETYPE::SQLSTATEMENT, WIRETYPE::LENGTHDELIM, data + datapos);
@@ -438,8 +456,6 @@ inline std::pair<unsigned char *, uint64_t> SqlStatementFrame::getData() const
   //std::cout << "2 DID " << param_ctr << " PARAMETERS!" << std::endl;
 
   //std::cout << "               " << bepaald::bytesToHexString(data, size) << std::endl;
-
-  return {data, size};
 }
 
 inline void SqlStatementFrame::setStatementField(std::string const &val)
@@ -449,11 +465,11 @@ inline void SqlStatementFrame::setStatementField(std::string const &val)
   d_framedata.emplace_back(std::make_tuple(static_cast<unsigned int>(FIELD::STATEMENT), temp, val.length()));
 }
 
-inline void SqlStatementFrame::addStringParameter(std::string const &val)
+inline void SqlStatementFrame::addStringParameter(std::string_view val)
 {
   //std::cout << "Adding string parameter: " << val << std::endl;
   unsigned char *temp = new unsigned char[val.length()];
-  std::memcpy(temp, val.c_str(), val.length());
+  std::memcpy(temp, val.data(), val.length());
   d_parameterdata.emplace_back(std::make_tuple(PARAMETER_FIELD::STRING, temp, val.length()));
   d_framedata.emplace_back(std::make_tuple(FIELD::PARAMETERS, nullptr, 0));
 }
@@ -466,6 +482,14 @@ inline void SqlStatementFrame::addBlobParameter(std::pair<std::shared_ptr<unsign
   d_framedata.emplace_back(std::make_tuple(FIELD::PARAMETERS, nullptr, 0));
 }
 
+inline void SqlStatementFrame::addBlobParameter(std::pair<unsigned char const *, size_t> const &val)
+{
+  unsigned char *temp = new unsigned char[val.second];
+  std::memcpy(temp, val.first, val.second);
+  d_parameterdata.emplace_back(std::make_tuple(PARAMETER_FIELD::BLOB, temp, val.second));
+  d_framedata.emplace_back(std::make_tuple(FIELD::PARAMETERS, nullptr, 0));
+}
+
 inline void SqlStatementFrame::addIntParameter(int64_t val)
 {
   val = bepaald::swap_endian(val);
@@ -574,6 +598,24 @@ inline std::string SqlStatementFrame::bindStatement() const
   return std::string();
 }
 
+inline bool SqlStatementFrame::isInsertStatement() const
+{
+  for (auto const &p : d_framedata)
+    if (std::get<0>(p) == FIELD::STATEMENT)
+    {
+      unsigned char const *data = std::get<1>(p);
+      uint64_t length = std::get<2>(p);
+      uint64_t pos = 0;
+      while (pos < length && std::isspace(data[pos]))
+        ++pos;
+      for (char const c : {'I', 'N', 'S', 'E', 'R', 'T'})
+        if (pos >= length || std::toupper(data[pos++]) != c)
+          return false;
+      return true;
+    }
+  return false;
+}
+
 inline std::vector<std::any> SqlStatementFrame::parameters() const
 {
   std::vector<std::any> parameters;
@@ -0,0 +1,73 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlstatementframe.ih"
+
+// returns the name of the table the statement operates on (the table created
+// or inserted into, or the table an index or trigger is created on), or
+// an empty string if it could not be determined
+std::string SqlStatementFrame::tableName() const
+{
+  std::string const statement(bindStatement());
+  std::string::size_type pos = 0;
+
+  auto nexttoken = [&]() { return nextToken(statement, &pos); };
+
+  auto upper = [](std::string s)
+  {
+    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return std::toupper(c); });
+    return s;
+  };
+
+  std::string token = upper(nexttoken());
+  if (token == "INSERT" || token == "REPLACE")
+  {
+    while (!(token = nexttoken()).empty() && upper(token) != "INTO")
+      ;
+    return nexttoken();
+  }
+
+  if (token == "CREATE")
+  {
+    token = upper(nexttoken());
+    while (token == "TEMP" || token == "TEMPORARY" || token == "UNIQUE" || token == "VIRTUAL")
+      token = upper(nexttoken());
+
+    if (token == "TABLE" || token == "VIEW")
+    {
+      std::string name = nexttoken();
+      if (upper(name) == "IF") // IF NOT EXISTS
+      {
+        nexttoken();
+        nexttoken();
+        name = nexttoken();
+      }
+      return name;
+    }
+
+    if (token == "INDEX" || token == "TRIGGER")
+    {
+      while (!(token = nexttoken()).empty() && upper(token) != "ON")
+        ;
+      return nexttoken();
+    }
+  }
+
+  return std::string();
+}